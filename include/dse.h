@@ -71,6 +71,14 @@ typedef struct DseGraphStatement_ DseGraphStatement;
  */
 typedef struct DseGraphObject_ DseGraphObject;
 
+/**
+ * Graph object template for efficiently constructing many objects with the
+ * same member names.
+ *
+ * @struct DseGraphObjectTemplate
+ */
+typedef struct DseGraphObjectTemplate_ DseGraphObjectTemplate;
+
 /**
  * Graph array builder for constructing an array of elements.
  *
@@ -78,6 +86,37 @@ typedef struct DseGraphObject_ DseGraphObject;
  */
 typedef struct DseGraphArray_ DseGraphArray;
 
+/**
+ * Graph builder pool for recycling graph objects and arrays.
+ *
+ * @struct DseGraphBuilderPool
+ */
+typedef struct DseGraphBuilderPool_ DseGraphBuilderPool;
+
+/**
+ * The number of size classes tracked by a graph builder pool.
+ */
+#define DSE_GRAPH_BUILDER_POOL_NUM_SIZE_CLASSES 8
+
+/**
+ * The largest length (in bytes) of a builder counted in a size class. The
+ * size classes grow by a factor of four starting at 256 bytes and the last
+ * size class counts all larger builders.
+ */
+#define DSE_GRAPH_BUILDER_POOL_SIZE_CLASS_MAX(size_class) ((size_t)256 << (2 * (size_class)))
+
+/**
+ * Graph builder pool statistics
+ *
+ * @struct DseGraphBuilderPoolStats
+ */
+typedef struct DseGraphBuilderPoolStats_ {
+  cass_uint64_t hits; /**< Builders reused from the pool */
+  cass_uint64_t misses; /**< Builders allocated because the pool was empty */
+  cass_uint64_t discarded; /**< Builders freed because the pool was full */
+  cass_uint64_t size_classes[DSE_GRAPH_BUILDER_POOL_NUM_SIZE_CLASSES]; /**< Released builders by length */
+} DseGraphBuilderPoolStats;
+
 /**
  * Graph result set
  *
@@ -152,6 +191,25 @@ typedef struct DseLineString_ DseLineString;
  */
 typedef struct DseLineStringIterator_ DseLineStringIterator;
 
+/**
+ * The number of bytes of storage used by a line string iterator that is
+ * initialized with dse_line_string_iterator_init().
+ */
+#define DSE_LINE_STRING_ITERATOR_SIZE 128
+
+/**
+ * Storage for a line string iterator that doesn't need to be allocated on
+ * the heap e.g. a local variable.
+ *
+ * @see dse_line_string_iterator_init()
+ */
+typedef union DseLineStringIteratorStorage_ {
+  char data[DSE_LINE_STRING_ITERATOR_SIZE];
+  cass_uint64_t alignment_uint64;
+  cass_double_t alignment_double;
+  void* alignment_pointer;
+} DseLineStringIteratorStorage;
+
 /**
  * @struct DsePolygon
  */
@@ -162,6 +220,85 @@ typedef struct DsePolygon_ DsePolygon;
  */
 typedef struct DsePolygonIterator_ DsePolygonIterator;
 
+/**
+ * The number of bytes of storage used by a polygon iterator that is
+ * initialized with dse_polygon_iterator_init(). This leaves room for the
+ * iterator to grow without changing the size of the storage.
+ */
+#define DSE_POLYGON_ITERATOR_SIZE 256
+
+/**
+ * Storage for a polygon iterator that doesn't need to be allocated on
+ * the heap e.g. a local variable.
+ *
+ * @see dse_polygon_iterator_init()
+ */
+typedef union DsePolygonIteratorStorage_ {
+  char data[DSE_POLYGON_ITERATOR_SIZE];
+  cass_uint64_t alignment_uint64;
+  cass_double_t alignment_double;
+  void* alignment_pointer;
+} DsePolygonIteratorStorage;
+
+/**
+ * @struct DseMultiPoint
+ */
+typedef struct DseMultiPoint_ DseMultiPoint;
+
+/**
+ * @struct DseMultiPointIterator
+ */
+typedef struct DseMultiPointIterator_ DseMultiPointIterator;
+
+/**
+ * @struct DseMultiLineString
+ */
+typedef struct DseMultiLineString_ DseMultiLineString;
+
+/**
+ * @struct DseMultiLineStringIterator
+ */
+typedef struct DseMultiLineStringIterator_ DseMultiLineStringIterator;
+
+/**
+ * @struct DseMultiPolygon
+ */
+typedef struct DseMultiPolygon_ DseMultiPolygon;
+
+/**
+ * @struct DseMultiPolygonIterator
+ */
+typedef struct DseMultiPolygonIterator_ DseMultiPolygonIterator;
+
+/**
+ * @struct DseGeometryCollection
+ */
+typedef struct DseGeometryCollection_ DseGeometryCollection;
+
+/**
+ * @struct DseGeometryCollectionIterator
+ */
+typedef struct DseGeometryCollectionIterator_ DseGeometryCollectionIterator;
+
+/**
+ * @struct DseGeometryArena
+ */
+typedef struct DseGeometryArena_ DseGeometryArena;
+
+/**
+ * @struct DseGeometryColumn
+ */
+typedef struct DseGeometryColumn_ DseGeometryColumn;
+
+/**
+ * Geometry types that can be contained in a geometry collection.
+ */
+typedef enum DseGeometryType_ {
+  DSE_GEOMETRY_TYPE_POINT = 1,
+  DSE_GEOMETRY_TYPE_LINE_STRING = 2,
+  DSE_GEOMETRY_TYPE_POLYGON = 3
+} DseGeometryType;
+
 /***********************************************************************************
  *
  * Cluster
@@ -504,6 +641,10 @@ dse_graph_statement_free(DseGraphStatement* statement);
 /**
  * Bind the values to a graph query.
  *
+ * <b>Note:</b> The values must be a finished object created using
+ * dse_graph_object_new() or dse_graph_builder_pool_get_object(). Nested
+ * objects return CASS_ERROR_LIB_BAD_PARAMS.
+ *
  * @public @memberof DseGraphStatement
  *
  * @param[in] statement
@@ -543,7 +684,8 @@ DSE_EXPORT DseGraphObject*
 dse_graph_object_new();
 
 /**
- * Frees a graph object instance.
+ * Frees a graph object instance. Nested objects are owned by their parent
+ * and are ignored.
  *
  * @public @memberof DseGraphObject
  *
@@ -774,6 +916,10 @@ dse_graph_object_add_string_n(DseGraphObject* object,
 /**
  * Add object to an object with the specified name.
  *
+ * <b>Note:</b> Nested objects returned by dse_graph_object_start_object() or
+ * dse_graph_array_start_object() can't be added and return
+ * CASS_ERROR_LIB_BAD_PARAMS.
+ *
  * @public @memberof DseGraphObject
  *
  * @param[in] object
@@ -807,6 +953,10 @@ dse_graph_object_add_object_n(DseGraphObject* object,
 /**
  * Add array to an object with the specified name.
  *
+ * <b>Note:</b> Nested arrays returned by dse_graph_object_start_array() or
+ * dse_graph_array_start_array() can't be added and return
+ * CASS_ERROR_LIB_BAD_PARAMS.
+ *
  * @public @memberof DseGraphObject
  *
  * @param[in] object
@@ -837,6 +987,88 @@ dse_graph_object_add_array_n(DseGraphObject* object,
                              size_t name_length,
                              const DseGraphArray* value);
 
+/**
+ * Start an object with the specified name inside of an object. The nested
+ * object is written directly into the parent's buffer so no copy is made when
+ * it's finished.
+ *
+ * Values can't be added to the parent until the nested object is finished
+ * using dse_graph_object_finish(). Finishing the parent also finishes
+ * any open nested objects or arrays.
+ *
+ * <b>Note:</b> The returned object is borrowed from the parent and is reused
+ * by later calls. It must not be freed, reset, released to a pool, added to
+ * another object or array, or bound to a statement. Those functions either
+ * ignore it or return CASS_ERROR_LIB_BAD_PARAMS.
+ *
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] name
+ * @return The nested object or NULL if the parent object is finished or
+ * has another nested object or array open.
+ */
+DSE_EXPORT DseGraphObject*
+dse_graph_object_start_object(DseGraphObject* object,
+                              const char* name);
+
+/**
+ * Same as dse_graph_object_start_object(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] name
+ * @param[in] name_length
+ * @return same as dse_graph_object_start_object()
+ */
+DSE_EXPORT DseGraphObject*
+dse_graph_object_start_object_n(DseGraphObject* object,
+                                const char* name,
+                                size_t name_length);
+
+/**
+ * Start an array with the specified name inside of an object. The nested
+ * array is written directly into the parent's buffer so no copy is made when
+ * it's finished.
+ *
+ * Values can't be added to the parent until the nested array is finished
+ * using dse_graph_array_finish(). Finishing the parent also finishes
+ * any open nested objects or arrays.
+ *
+ * <b>Note:</b> The returned array is borrowed from the parent and is reused
+ * by later calls. It must not be freed, reset, released to a pool, added to
+ * another object or array, or bound to a statement. Those functions either
+ * ignore it or return CASS_ERROR_LIB_BAD_PARAMS.
+ *
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] name
+ * @return The nested array or NULL if the parent object is finished or
+ * has another nested object or array open.
+ */
+DSE_EXPORT DseGraphArray*
+dse_graph_object_start_array(DseGraphObject* object,
+                             const char* name);
+
+/**
+ * Same as dse_graph_object_start_array(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] name
+ * @param[in] name_length
+ * @return same as dse_graph_object_start_array()
+ */
+DSE_EXPORT DseGraphArray*
+dse_graph_object_start_array_n(DseGraphObject* object,
+                               const char* name,
+                               size_t name_length);
+
 /**
  * Add point geometric type to an object with the specified name.
  *
@@ -938,1044 +1170,3257 @@ dse_graph_object_add_polygon_n(DseGraphObject* object,
                                size_t name_length,
                                const DsePolygon* value);
 
-/***********************************************************************************
- *
- * Graph Array
- *
- ***********************************************************************************/
-
 /**
- * Creates a new instance of graph array.
+ * Add multi point geometric type to an object with the specified name.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] name
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT DseGraphArray*
-dse_graph_array_new();
+DSE_EXPORT CassError
+dse_graph_object_add_multi_point(DseGraphObject* object,
+                                 const char* name,
+                                 const DseMultiPoint* value);
 
 /**
- * Frees a graph array instance.
+ * Same as dse_graph_object_add_multi_point(), but with lengths for string
+ * parameters.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] value
+ * @return same as dse_graph_object_add_multi_point()
  */
-DSE_EXPORT void
-dse_graph_array_free(DseGraphArray* array);
+DSE_EXPORT CassError
+dse_graph_object_add_multi_point_n(DseGraphObject* object,
+                                   const char* name,
+                                   size_t name_length,
+                                   const DseMultiPoint* value);
 
 /**
- * Reset a graph array. This function must be called after previously finishing
- * an array (dse_graph_array_finish()). This can be used to resuse an
- * instance of DseGraphArray to create multiple arrays.
+ * Add multi line string geometric type to an object with the specified name.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT void
-dse_graph_array_reset(DseGraphArray* array);
+DSE_EXPORT CassError
+dse_graph_object_add_multi_line_string(DseGraphObject* object,
+                                       const char* name,
+                                       const DseMultiLineString* value);
 
 /**
- * Finish a graph array. This function must be called before adding an array to
- * another object, array or binding to a statement.
+ * Same as dse_graph_object_add_multi_line_string(), but with lengths for string
+ * parameters.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] value
+ * @return same as dse_graph_object_add_multi_line_string()
  */
-DSE_EXPORT void
-dse_graph_array_finish(DseGraphArray* array);
+DSE_EXPORT CassError
+dse_graph_object_add_multi_line_string_n(DseGraphObject* object,
+                                         const char* name,
+                                         size_t name_length,
+                                         const DseMultiLineString* value);
 
 /**
- * Add null to an array.
+ * Add multi polygon geometric type to an object with the specified name.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
+ * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_null(DseGraphArray* array);
+dse_graph_object_add_multi_polygon(DseGraphObject* object,
+                                   const char* name,
+                                   const DseMultiPolygon* value);
 
 /**
- * Add boolean to an array.
+ * Same as dse_graph_object_add_multi_polygon(), but with lengths for string
+ * parameters.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
+ * @param[in] name_length
  * @param[in] value
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @return same as dse_graph_object_add_multi_polygon()
  */
 DSE_EXPORT CassError
-dse_graph_array_add_bool(DseGraphArray* array,
-                         cass_bool_t value);
+dse_graph_object_add_multi_polygon_n(DseGraphObject* object,
+                                     const char* name,
+                                     size_t name_length,
+                                     const DseMultiPolygon* value);
 
 /**
- * Add integer (32-bit) to an array.
+ * Add geometry collection geometric type to an object with the specified name.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
  * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_int32(DseGraphArray* array,
-                          cass_int32_t value);
+dse_graph_object_add_geometry_collection(DseGraphObject* object,
+                                         const char* name,
+                                         const DseGeometryCollection* value);
 
 /**
- * Add integer (64-bit) to an array.
+ * Same as dse_graph_object_add_geometry_collection(), but with lengths for string
+ * parameters.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] name
+ * @param[in] name_length
  * @param[in] value
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @return same as dse_graph_object_add_geometry_collection()
  */
 DSE_EXPORT CassError
-dse_graph_array_add_int64(DseGraphArray* array,
-                          cass_int64_t value);
+dse_graph_object_add_geometry_collection_n(DseGraphObject* object,
+                                           const char* name,
+                                           size_t name_length,
+                                           const DseGeometryCollection* value);
+
+/***********************************************************************************
+ *
+ * Graph Object Template
+ *
+ ***********************************************************************************/
 
 /**
- * Add double to an array.
+ * Creates a new instance of graph object template. A template encodes member
+ * names once so that they can be added to many objects by index without
+ * being escaped or validated again.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObjectTemplate
+ */
+DSE_EXPORT DseGraphObjectTemplate*
+dse_graph_object_template_new();
+
+/**
+ * Frees a graph object template instance.
  *
- * @param[in] array
- * @param[in] value
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @public @memberof DseGraphObjectTemplate
+ *
+ * @param[in] object_template
  */
-DSE_EXPORT CassError
-dse_graph_array_add_double(DseGraphArray* array,
-                           cass_double_t value);
+DSE_EXPORT void
+dse_graph_object_template_free(DseGraphObjectTemplate* object_template);
 
 /**
- * Add string to an array.
+ * Add a member name to a template. Names are indexed in the order that
+ * they're added starting from zero.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObjectTemplate
  *
- * @param[in] array
- * @param[in] value
+ * @param[in] object_template
+ * @param[in] name
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_string(DseGraphArray* array,
-                           const char* value);
+dse_graph_object_template_add_name(DseGraphObjectTemplate* object_template,
+                                   const char* name);
 
 /**
- * Same as dse_graph_array_add_string(), but with lengths for string
+ * Same as dse_graph_object_template_add_name(), but with lengths for string
  * parameters.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObjectTemplate
  *
- * @param[in] array
- * @param[in] value
- * @param[in] value_length
- * @return same as dse_graph_array_add_string()
+ * @param[in] object_template
+ * @param[in] name
+ * @param[in] name_length
+ * @return same as dse_graph_object_template_add_name()
  */
 DSE_EXPORT CassError
-dse_graph_array_add_string_n(DseGraphArray* array,
-                             const char* value,
-                             size_t value_length);
+dse_graph_object_template_add_name_n(DseGraphObjectTemplate* object_template,
+                                     const char* name,
+                                     size_t name_length);
 
 /**
- * Add object to an array.
+ * Gets the number of member names in a template.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObjectTemplate
  *
- * @param[in] array
- * @param[in] value
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @param[in] object_template
+ * @return The number of member names.
  */
-DSE_EXPORT CassError
-dse_graph_array_add_object(DseGraphArray* array,
-                           const DseGraphObject* value);
+DSE_EXPORT size_t
+dse_graph_object_template_name_count(const DseGraphObjectTemplate* object_template);
 
 /**
- * Add array to an array.
+ * Add null to an object using the template's member name at the specified
+ * index.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_object_add_null_by_index(DseGraphObject* object,
+                                   const DseGraphObjectTemplate* object_template,
+                                   size_t index);
+
+/**
+ * Add boolean to an object using the template's member name at the specified
+ * index.
+ *
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
  * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_array(DseGraphArray* array,
-                          const DseGraphArray* value);
+dse_graph_object_add_bool_by_index(DseGraphObject* object,
+                                   const DseGraphObjectTemplate* object_template,
+                                   size_t index,
+                                   cass_bool_t value);
 
 /**
- * Add point geometric type to an array.
+ * Add integer (32-bit) to an object using the template's member name at the
+ * specified index.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
- * @param[in] x
- * @param[in] y
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_point(DseGraphArray* array,
-                          cass_double_t x, cass_double_t y);
+dse_graph_object_add_int32_by_index(DseGraphObject* object,
+                                    const DseGraphObjectTemplate* object_template,
+                                    size_t index,
+                                    cass_int32_t value);
 
 /**
- * Add line string geometric type to an array.
+ * Add integer (64-bit) to an object using the template's member name at the
+ * specified index.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
  * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_line_string(DseGraphArray* array,
-                                const DseLineString* value);
+dse_graph_object_add_int64_by_index(DseGraphObject* object,
+                                    const DseGraphObjectTemplate* object_template,
+                                    size_t index,
+                                    cass_int64_t value);
 
 /**
- * Add polygon geometric type to an array.
+ * Add double to an object using the template's member name at the specified
+ * index.
  *
- * @public @memberof DseGraphArray
+ * @public @memberof DseGraphObject
  *
- * @param[in] array
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
  * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_array_add_polygon(DseGraphArray* array,
-                            const DsePolygon* value);
+dse_graph_object_add_double_by_index(DseGraphObject* object,
+                                     const DseGraphObjectTemplate* object_template,
+                                     size_t index,
+                                     cass_double_t value);
 
-/***********************************************************************************
+/**
+ * Add string to an object using the template's member name at the specified
+ * index.
  *
- * Graph Result Set
+ * @public @memberof DseGraphObject
  *
- ***********************************************************************************/
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_object_add_string_by_index(DseGraphObject* object,
+                                     const DseGraphObjectTemplate* object_template,
+                                     size_t index,
+                                     const char* value);
 
 /**
- * Frees a graph result set instance.
+ * Same as dse_graph_object_add_string_by_index(), but with lengths for string
+ * parameters.
  *
- * @public @memberof DseGraphResultSet
+ * @public @memberof DseGraphObject
  *
- * @param[in] resultset
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @param[in] value
+ * @param[in] value_length
+ * @return same as dse_graph_object_add_string_by_index()
  */
-DSE_EXPORT void
-dse_graph_resultset_free(DseGraphResultSet* resultset);
+DSE_EXPORT CassError
+dse_graph_object_add_string_by_index_n(DseGraphObject* object,
+                                       const DseGraphObjectTemplate* object_template,
+                                       size_t index,
+                                       const char* value,
+                                       size_t value_length);
 
 /**
- * Returns the number of results in the result set.
+ * Add point geometric type to an object using the template's member name at
+ * the specified index.
  *
- * @public @memberof DseGraphResultSet
+ * @public @memberof DseGraphObject
  *
- * @param[in] resultset
- * @return The number of results in the result set.
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT size_t
-dse_graph_resultset_count(DseGraphResultSet* resultset);
+DSE_EXPORT CassError
+dse_graph_object_add_point_by_index(DseGraphObject* object,
+                                    const DseGraphObjectTemplate* object_template,
+                                    size_t index,
+                                    cass_double_t x, cass_double_t y);
 
 /**
- * Returns the next result in the result set.
+ * Start an object inside of an object using the template's member name at
+ * the specified index.
  *
- * @public @memberof DseGraphResultSet
+ * @public @memberof DseGraphObject
  *
- * @param[in] resultset
- * @return The next result.
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @return The nested object or NULL if the index is out of bounds or the
+ * parent object can't be modified.
+ *
+ * @see dse_graph_object_start_object()
  */
-DSE_EXPORT const DseGraphResult*
-dse_graph_resultset_next(DseGraphResultSet* resultset);
+DSE_EXPORT DseGraphObject*
+dse_graph_object_start_object_by_index(DseGraphObject* object,
+                                       const DseGraphObjectTemplate* object_template,
+                                       size_t index);
+
+/**
+ * Start an array inside of an object using the template's member name at
+ * the specified index.
+ *
+ * @public @memberof DseGraphObject
+ *
+ * @param[in] object
+ * @param[in] object_template
+ * @param[in] index
+ * @return The nested array or NULL if the index is out of bounds or the
+ * parent object can't be modified.
+ *
+ * @see dse_graph_object_start_array()
+ */
+DSE_EXPORT DseGraphArray*
+dse_graph_object_start_array_by_index(DseGraphObject* object,
+                                      const DseGraphObjectTemplate* object_template,
+                                      size_t index);
 
 /***********************************************************************************
  *
- * Graph Result
+ * Graph Array
  *
  ***********************************************************************************/
 
 /**
- * Returns the type of the result.
+ * Creates a new instance of graph array.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
+ */
+DSE_EXPORT DseGraphArray*
+dse_graph_array_new();
+
+/**
+ * Frees a graph array instance. Nested arrays are owned by their parent
+ * and are ignored.
  *
- * @param[in] result
- * @return The type of the current result.
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
  */
-DSE_EXPORT DseGraphResultType
-dse_graph_result_type(const DseGraphResult* result);
+DSE_EXPORT void
+dse_graph_array_free(DseGraphArray* array);
 
 /**
- * Returns true if the result is null.
+ * Reset a graph array. This function must be called after previously finishing
+ * an array (dse_graph_array_finish()). This can be used to resuse an
+ * instance of DseGraphArray to create multiple arrays.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is null, otherwise false.
+ * @param[in] array
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_null(const DseGraphResult* result);
+DSE_EXPORT void
+dse_graph_array_reset(DseGraphArray* array);
 
 /**
- * Returns true if the result is a boolean.
+ * Finish a graph array. This function must be called before adding an array to
+ * another object, array or binding to a statement.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is boolean, otherwise false.
+ * @param[in] array
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_bool(const DseGraphResult* result);
+DSE_EXPORT void
+dse_graph_array_finish(DseGraphArray* array);
 
 /**
- * Returns true if the result is an integer (32-bit).
+ * Add null to an array.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is a number that be held in an integer (32-bit),
- * otherwise false.
+ * @param[in] array
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_int32(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_null(DseGraphArray* array);
 
 /**
- * Returns true if the result is an integer (64-bit).
+ * Add boolean to an array.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is a number that be held in an integer (64-bit),
- * otherwise false.
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_int64(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_bool(DseGraphArray* array,
+                         cass_bool_t value);
 
 /**
- * Returns true if the result is a double.
+ * Add integer (32-bit) to an array.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is a number that be held in a double,
- * otherwise false.
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_double(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_int32(DseGraphArray* array,
+                          cass_int32_t value);
 
 /**
- * Returns true if the result is a string.
+ * Add integer (64-bit) to an array.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is a string, otherwise false.
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_string(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_int64(DseGraphArray* array,
+                          cass_int64_t value);
 
 /**
- * Returns true if the result is an object.
+ * Add double to an array.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is a object, otherwise false.
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_object(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_double(DseGraphArray* array,
+                           cass_double_t value);
 
 /**
- * Returns true if the result is an array.
+ * Add many integers (64-bit) to an array. This is faster than calling
+ * dse_graph_array_add_int64() for each value.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return True if the result is a array, otherwise false.
+ * @param[in] array
+ * @param[in] values
+ * @param[in] count
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_is_array(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_int64_n(DseGraphArray* array,
+                            const cass_int64_t* values,
+                            size_t count);
 
 /**
- * Get the boolean value from the result.
+ * Add many doubles to an array. This is faster than calling
+ * dse_graph_array_add_double() for each value.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseGraphArray
  *
- * @param[in] result
- * @return The boolean value.
+ * @param[in] array
+ * @param[in] values
+ * @param[in] count
+ * @return CASS_OK if successful, otherwise an error occurred. No values are
+ * added if any of them are NaN or infinite.
  */
-DSE_EXPORT cass_bool_t
-dse_graph_result_get_bool(const DseGraphResult* result);
+DSE_EXPORT CassError
+dse_graph_array_add_double_n(DseGraphArray* array,
+                             const cass_double_t* values,
+                             size_t count);
+
+/**
+ * Add string to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_string(DseGraphArray* array,
+                           const char* value);
+
+/**
+ * Same as dse_graph_array_add_string(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @param[in] value_length
+ * @return same as dse_graph_array_add_string()
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_string_n(DseGraphArray* array,
+                             const char* value,
+                             size_t value_length);
+
+/**
+ * Add object to an array.
+ *
+ * <b>Note:</b> Nested objects returned by dse_graph_object_start_object() or
+ * dse_graph_array_start_object() can't be added and return
+ * CASS_ERROR_LIB_BAD_PARAMS.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_object(DseGraphArray* array,
+                           const DseGraphObject* value);
+
+/**
+ * Add array to an array.
+ *
+ * <b>Note:</b> Nested arrays returned by dse_graph_object_start_array() or
+ * dse_graph_array_start_array() can't be added and return
+ * CASS_ERROR_LIB_BAD_PARAMS.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_array(DseGraphArray* array,
+                          const DseGraphArray* value);
+
+/**
+ * Start an object inside of an array. The nested object is written directly
+ * into the parent's buffer so no copy is made when it's finished.
+ *
+ * Values can't be added to the parent until the nested object is finished
+ * using dse_graph_object_finish(). Finishing the parent also finishes
+ * any open nested objects or arrays.
+ *
+ * <b>Note:</b> The returned object is borrowed from the parent and is reused
+ * by later calls. It must not be freed, reset, released to a pool, added to
+ * another object or array, or bound to a statement. Those functions either
+ * ignore it or return CASS_ERROR_LIB_BAD_PARAMS.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @return The nested object or NULL if the parent array is finished or
+ * has another nested object or array open.
+ */
+DSE_EXPORT DseGraphObject*
+dse_graph_array_start_object(DseGraphArray* array);
+
+/**
+ * Start an array inside of an array. The nested array is written directly
+ * into the parent's buffer so no copy is made when it's finished.
+ *
+ * Values can't be added to the parent until the nested array is finished
+ * using dse_graph_array_finish(). Finishing the parent also finishes
+ * any open nested objects or arrays.
+ *
+ * <b>Note:</b> The returned array is borrowed from the parent and is reused
+ * by later calls. It must not be freed, reset, released to a pool, added to
+ * another object or array, or bound to a statement. Those functions either
+ * ignore it or return CASS_ERROR_LIB_BAD_PARAMS.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @return The nested array or NULL if the parent array is finished or
+ * has another nested object or array open.
+ */
+DSE_EXPORT DseGraphArray*
+dse_graph_array_start_array(DseGraphArray* array);
+
+/**
+ * Add point geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_point(DseGraphArray* array,
+                          cass_double_t x, cass_double_t y);
+
+/**
+ * Add line string geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_line_string(DseGraphArray* array,
+                                const DseLineString* value);
+
+/**
+ * Add polygon geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_polygon(DseGraphArray* array,
+                            const DsePolygon* value);
+
+/**
+ * Add multi point geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_multi_point(DseGraphArray* array,
+                                const DseMultiPoint* value);
+
+/**
+ * Add multi line string geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_multi_line_string(DseGraphArray* array,
+                                      const DseMultiLineString* value);
+
+/**
+ * Add multi polygon geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_multi_polygon(DseGraphArray* array,
+                                  const DseMultiPolygon* value);
+
+/**
+ * Add geometry collection geometric type to an array.
+ *
+ * @public @memberof DseGraphArray
+ *
+ * @param[in] array
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_array_add_geometry_collection(DseGraphArray* array,
+                                        const DseGeometryCollection* value);
+
+/***********************************************************************************
+ *
+ * Graph Builder Pool
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new instance of graph builder pool. Released graph objects and
+ * arrays are kept in the pool so that their buffers can be reused by later
+ * requests. New builders are allocated with buffers large enough for the most
+ * common size of released builders.
+ *
+ * <b>Note:</b> A pool is not thread-safe. Each thread should use its own pool.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] max_idle The maximum number of objects and the maximum number
+ * of arrays kept in the pool.
+ * @return Returns a graph builder pool that must be freed.
+ *
+ * @see dse_graph_builder_pool_free()
+ */
+DSE_EXPORT DseGraphBuilderPool*
+dse_graph_builder_pool_new(size_t max_idle);
+
+/**
+ * Frees a graph builder pool instance and the builders kept in it. Builders
+ * that haven't been released are not freed.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] pool
+ */
+DSE_EXPORT void
+dse_graph_builder_pool_free(DseGraphBuilderPool* pool);
+
+/**
+ * Gets an empty graph object from the pool or allocates a new one if the
+ * pool is empty.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] pool
+ * @return Returns a graph object that must be released back to the pool or
+ * freed.
+ *
+ * @see dse_graph_builder_pool_release_object()
+ * @see dse_graph_object_free()
+ */
+DSE_EXPORT DseGraphObject*
+dse_graph_builder_pool_get_object(DseGraphBuilderPool* pool);
+
+/**
+ * Gets an empty graph array from the pool or allocates a new one if the
+ * pool is empty.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] pool
+ * @return Returns a graph array that must be released back to the pool or
+ * freed.
+ *
+ * @see dse_graph_builder_pool_release_array()
+ * @see dse_graph_array_free()
+ */
+DSE_EXPORT DseGraphArray*
+dse_graph_builder_pool_get_array(DseGraphBuilderPool* pool);
+
+/**
+ * Releases a graph object back to the pool. The object is reset and must not
+ * be used after it's released. It's freed if the pool is already full.
+ *
+ * <b>Note:</b> Objects that were allocated using dse_graph_object_new() can
+ * also be released to a pool.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] pool
+ * @param[in] object
+ * @return CASS_OK if successful, otherwise an error occurred. Nested objects
+ * are owned by their parent and return CASS_ERROR_LIB_BAD_PARAMS.
+ */
+DSE_EXPORT CassError
+dse_graph_builder_pool_release_object(DseGraphBuilderPool* pool,
+                                      DseGraphObject* object);
+
+/**
+ * Releases a graph array back to the pool. The array is reset and must not
+ * be used after it's released. It's freed if the pool is already full.
+ *
+ * <b>Note:</b> Arrays that were allocated using dse_graph_array_new() can
+ * also be released to a pool.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] pool
+ * @param[in] array
+ * @return CASS_OK if successful, otherwise an error occurred. Nested arrays
+ * are owned by their parent and return CASS_ERROR_LIB_BAD_PARAMS.
+ */
+DSE_EXPORT CassError
+dse_graph_builder_pool_release_array(DseGraphBuilderPool* pool,
+                                     DseGraphArray* array);
+
+/**
+ * Gets a snapshot of the pool's statistics.
+ *
+ * @public @memberof DseGraphBuilderPool
+ *
+ * @param[in] pool
+ * @param[out] stats
+ */
+DSE_EXPORT void
+dse_graph_builder_pool_get_stats(const DseGraphBuilderPool* pool,
+                                 DseGraphBuilderPoolStats* stats);
+
+/***********************************************************************************
+ *
+ * Graph Result Set
+ *
+ ***********************************************************************************/
+
+/**
+ * Frees a graph result set instance.
+ *
+ * @public @memberof DseGraphResultSet
+ *
+ * @param[in] resultset
+ */
+DSE_EXPORT void
+dse_graph_resultset_free(DseGraphResultSet* resultset);
+
+/**
+ * Returns the number of results in the result set.
+ *
+ * @public @memberof DseGraphResultSet
+ *
+ * @param[in] resultset
+ * @return The number of results in the result set.
+ */
+DSE_EXPORT size_t
+dse_graph_resultset_count(DseGraphResultSet* resultset);
+
+/**
+ * Returns the next result in the result set.
+ *
+ * @public @memberof DseGraphResultSet
+ *
+ * @param[in] resultset
+ * @return The next result.
+ */
+DSE_EXPORT const DseGraphResult*
+dse_graph_resultset_next(DseGraphResultSet* resultset);
+
+/***********************************************************************************
+ *
+ * Graph Result
+ *
+ ***********************************************************************************/
+
+/**
+ * Returns the type of the result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The type of the current result.
+ */
+DSE_EXPORT DseGraphResultType
+dse_graph_result_type(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is null.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is null, otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_null(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is a boolean.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is boolean, otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_bool(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is an integer (32-bit).
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is a number that be held in an integer (32-bit),
+ * otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_int32(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is an integer (64-bit).
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is a number that be held in an integer (64-bit),
+ * otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_int64(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is a double.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is a number that be held in a double,
+ * otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_double(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is a string.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is a string, otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_string(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is an object.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is a object, otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_object(const DseGraphResult* result);
+
+/**
+ * Returns true if the result is an array.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return True if the result is a array, otherwise false.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_is_array(const DseGraphResult* result);
+
+/**
+ * Get the boolean value from the result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The boolean value.
+ */
+DSE_EXPORT cass_bool_t
+dse_graph_result_get_bool(const DseGraphResult* result);
+
+/**
+ * Get the integer (32-bit) value from the result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The integer (32-bit) value.
+ */
+DSE_EXPORT cass_int32_t
+dse_graph_result_get_int32(const DseGraphResult* result);
+
+/**
+ * Get the integer (64-bit) value from the result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The integer (64-bit) value.
+ */
+DSE_EXPORT cass_int64_t
+dse_graph_result_get_int64(const DseGraphResult* result);
+
+/**
+ * Get the double value from the result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The double value.
+ */
+DSE_EXPORT cass_double_t
+dse_graph_result_get_double(const DseGraphResult* result);
+
+/**
+ * Get the string value from the result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] length
+ * @return The string value.
+ */
+DSE_EXPORT const char*
+dse_graph_result_get_string(const DseGraphResult* result,
+                            size_t* length);
+
+/**
+ * Return an object as an graph edge.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] edge
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_edge(const DseGraphResult* result,
+                         DseGraphEdgeResult* edge);
+
+/**
+ * Return an object as an graph vertex.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] vertex
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_vertex(const DseGraphResult* result,
+                           DseGraphVertexResult* vertex);
+
+/**
+ * Return an object as an graph path.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] path
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_path(const DseGraphResult* result,
+                         DseGraphPathResult* path);
+
+/**
+ * Return an object as the point geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] x
+ * @param[out] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_point(const DseGraphResult* result,
+                          cass_double_t* x, cass_double_t* y);
+
+/**
+ * Return an object as the line string geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] line_string
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_line_string(const DseGraphResult* result,
+                                DseLineStringIterator* line_string);
+
+/**
+ * Return an object as the polygon geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_polygon(const DseGraphResult* result,
+                            DsePolygonIterator* polygon);
+
+/**
+ * Return an object as the multi point geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] multi_point
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_multi_point(const DseGraphResult* result,
+                                DseMultiPointIterator* multi_point);
+
+/**
+ * Return an object as the multi line string geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] multi_line_string
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_multi_line_string(const DseGraphResult* result,
+                                      DseMultiLineStringIterator* multi_line_string);
+
+/**
+ * Return an object as the multi polygon geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] multi_polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_multi_polygon(const DseGraphResult* result,
+                                  DseMultiPolygonIterator* multi_polygon);
+
+/**
+ * Return an object as the geometry collection geometric type.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[out] geometry_collection
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_graph_result_as_geometry_collection(const DseGraphResult* result,
+                                        DseGeometryCollectionIterator* geometry_collection);
+
+/**
+ * Returns the number of members in an object result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The number of members in an object result.
+ */
+DSE_EXPORT size_t
+dse_graph_result_member_count(const DseGraphResult* result);
+
+/**
+ * Return the string key of an object at the specified index.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[in] index
+ * @param[out] length
+ * @return The string key of the member.
+ */
+DSE_EXPORT const char*
+dse_graph_result_member_key(const DseGraphResult* result,
+                            size_t index,
+                            size_t* length);
+
+/**
+ * Return the result value of an object at the specified index.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[in] index
+ *
+ * @return The result value of the member.
+ */
+DSE_EXPORT const DseGraphResult*
+dse_graph_result_member_value(const DseGraphResult* result,
+                              size_t index);
+
+/**
+ * Returns the number of elements in an array result.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @return The number of elements in array result.
+ */
+DSE_EXPORT size_t
+dse_graph_result_element_count(const DseGraphResult* result);
+
+/**
+ * Returns the result value of an array at the specified index.
+ *
+ * @public @memberof DseGraphResult
+ *
+ * @param[in] result
+ * @param[in] index
+ * @return The result value.
+ */
+DSE_EXPORT const DseGraphResult*
+dse_graph_result_element(const DseGraphResult* result,
+                         size_t index);
+
+/***********************************************************************************
+ *
+ * Statement
+ *
+ ***********************************************************************************/
+
+/**
+ * Binds point to a query or bound statement at the specified index.
+ *
+ * <b>Note:</b> The point is encoded on the stack and copied into the
+ * statement without a heap allocation.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] index
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_point(CassStatement* statement,
+                              size_t index,
+                              cass_double_t x, cass_double_t y);
+
+/**
+ * Binds a point to all the values with the specified name.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_point_by_name(CassStatement* statement,
+                                      const char* name,
+                                      cass_double_t x, cass_double_t y);
+
+/**
+ * Same as cass_statement_bind_dse_point_by_name(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] x
+ * @param[in] y
+ * @return same as cass_statement_bind_dse_point_by_name()
+ *
+ * @see cass_statement_bind_dse_point_by_name()
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_point_by_name_n(CassStatement* statement,
+                                        const char* name, size_t name_length,
+                                        cass_double_t x, cass_double_t y);
+
+/**
+ * Binds line string to a query or bound statement at the specified index.
+ *
+ * <b>Note:</b> The line string's bytes are copied into the statement so it can be
+ * freed or reset after it's bound.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] index
+ * @param[in] line_string
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_line_string(CassStatement* statement,
+                                    size_t index,
+                                    const DseLineString* line_string);
+
+/**
+ * Binds a line string to all the values with the specified name.
+ *
+ * <b>Note:</b> The line string's bytes are copied into the statement.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] line_string
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_line_string_by_name(CassStatement* statement,
+                                            const char* name,
+                                            const DseLineString* line_string);
+
+/**
+ * Same as cass_statement_bind_dse_line_string_by_name(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] line_string
+ * @return same as cass_statement_bind_dse_line_string_by_name()
+ *
+ * @see cass_statement_bind_dse_line_string_by_name()
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_line_string_by_name_n(CassStatement* statement,
+                                              const char* name, size_t name_length,
+                                              const DseLineString* line_string);
+
+/**
+ * Binds polygon to a query or bound statement at the specified index.
+ *
+ * <b>Note:</b> The polygon's bytes are copied into the statement so it can be
+ * freed or reset after it's bound.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] index
+ * @param[in] polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_polygon(CassStatement* statement,
+                                size_t index,
+                                const DsePolygon* polygon);
+
+/**
+ * Binds a polygon to all the values with the specified name.
+ *
+ * <b>Note:</b> The polygon's bytes are copied into the statement.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_polygon_by_name(CassStatement* statement,
+                                        const char* name,
+                                        const DsePolygon* polygon);
+
+/**
+ * Same as cass_statement_bind_dse_polygon_by_name(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof CassStatement
+ *
+ * @param[in] statement
+ * @param[in] name
+ * @param[in] name_length
+ * @param[in] polygon
+ * @return same as cass_statement_bind_dse_polygon_by_name()
+ *
+ * @see cass_statement_bind_dse_polygon_by_name()
+ */
+DSE_EXPORT CassError
+cass_statement_bind_dse_polygon_by_name_n(CassStatement* statement,
+                                          const char* name, size_t name_length,
+                                          const DsePolygon* polygon);
+
+/***********************************************************************************
+ *
+ * Value
+ *
+ ***********************************************************************************/
+
+/**
+ * Gets a point for the specified value.
+ *
+ * @public @memberof CassValue
+ *
+ * @param[in] value
+ * @param[out] x
+ * @param[out] y
+ * @return CASS_OK if successful, otherwise error occurred
+ */
+DSE_EXPORT CassError
+cass_value_get_dse_point(const CassValue* value,
+                         cass_double_t* x, cass_double_t* y);
+
+/***********************************************************************************
+ *
+ * Line String
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new line string.
+ *
+ * @public @memberof DseLineString
+ *
+ * @return Returns a line string that must be freed.
+ *
+ * @see dse_line_string_free()
+ */
+DSE_EXPORT DseLineString*
+dse_line_string_new();
+
+/**
+ * Frees a line string instance.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ */
+DSE_EXPORT void
+dse_line_string_free(DseLineString* line_string);
+
+/**
+ * Resets a line string so that it can be reused.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ */
+DSE_EXPORT void
+dse_line_string_reset(DseLineString* line_string);
+
+/**
+ * Reserves enough memory to contain the provided number of points. This can
+ * be use to reduce memory allocations, but it is not required.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] num_points
+ */
+DSE_EXPORT void
+dse_line_string_reserve(DseLineString* line_string,
+                        cass_uint32_t num_points);
+
+/**
+ * Adds a point to the line string.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_add_point(DseLineString* line_string,
+                          cass_double_t x, cass_double_t y);
+
+/**
+ * Adds multiple points to the line string. The points are copied directly
+ * into the line string's buffer which is much faster than calling
+ * dse_line_string_add_point() for each point.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] points An array of interleaved x and y coordinates
+ * (x0, y0, x1, y1, ...). It must contain 2 * num_points values.
+ * @param[in] num_points
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_add_points_n(DseLineString* line_string,
+                             const cass_double_t* points,
+                             size_t num_points);
+
+/**
+ * Same as dse_line_string_add_points_n(), but with separate arrays for the
+ * x and y coordinates.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] x An array of num_points x coordinates
+ * @param[in] y An array of num_points y coordinates
+ * @param[in] num_points
+ * @return same as dse_line_string_add_points_n()
+ *
+ * @see dse_line_string_add_points_n()
+ */
+DSE_EXPORT CassError
+dse_line_string_add_points_xy_n(DseLineString* line_string,
+                                const cass_double_t* x,
+                                const cass_double_t* y,
+                                size_t num_points);
+
+/**
+ * Finishes the contruction of a line string.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_finish(DseLineString* line_string);
+
+/**
+ * Replaces the contents of a line string with a line string parsed from
+ * well-known text (WKT) e.g. "LINESTRING (0 0, 1 1)". The line string is
+ * finished and ready to be bound.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] wkt
+ * @return CASS_OK if successful, otherwise an error occurred. The line string
+ * is reset if the text is not a valid line string.
+ */
+DSE_EXPORT CassError
+dse_line_string_from_wkt(DseLineString* line_string,
+                         const char* wkt);
+
+/**
+ * Same as dse_line_string_from_wkt(), but with lengths for string
+ * parameters.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] wkt
+ * @param[in] wkt_length
+ * @return same as dse_line_string_from_wkt()
+ *
+ * @see dse_line_string_from_wkt()
+ */
+DSE_EXPORT CassError
+dse_line_string_from_wkt_n(DseLineString* line_string,
+                           const char* wkt,
+                           size_t wkt_length);
+
+/**
+ * Gets the bounding box of the points added to a line string. The bounding
+ * box is maintained as points are added so this doesn't require a pass
+ * over the points.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[out] min_x
+ * @param[out] min_y
+ * @param[out] max_x
+ * @param[out] max_y
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if no points have been added.
+ */
+DSE_EXPORT CassError
+dse_line_string_envelope(const DseLineString* line_string,
+                         cass_double_t* min_x, cass_double_t* min_y,
+                         cass_double_t* max_x, cass_double_t* max_y);
+
+/**
+ * Removes points from a line string that are within a distance of the
+ * simplified line string (Douglas-Peucker). The first and last points are
+ * always kept. This is done in place so it's a cheap way to reduce the size
+ * of a line string before it's bound e.g. to remove the redundant points
+ * of a GPS trace. A tolerance of 0 only removes collinear points.
+ *
+ * @public @memberof DseLineString
+ *
+ * @param[in] line_string
+ * @param[in] tolerance The largest distance, in the units of the coordinates,
+ * that a removed point can be from the simplified line string.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_simplify(DseLineString* line_string,
+                         cass_double_t tolerance);
+
+/***********************************************************************************
+ *
+ * Line String Iterator
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new line string iterator.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @return Returns an iterator that must be freed.
+ *
+ * @see dse_line_string_iterator_free()
+ */
+DSE_EXPORT DseLineStringIterator*
+dse_line_string_iterator_new();
+
+/**
+ * Frees a line string iterator instance.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ */
+DSE_EXPORT void
+dse_line_string_iterator_free(DseLineStringIterator* iterator);
+
+/**
+ * Creates a new line string iterator in storage provided by the caller instead
+ * of allocating it on the heap. This avoids allocations when an iterator is
+ * only needed briefly e.g. in a loop over rows.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] storage
+ * @return Returns an iterator that must be destroyed before the storage is
+ * reused or goes out of scope.
+ *
+ * @see dse_line_string_iterator_destroy()
+ */
+DSE_EXPORT DseLineStringIterator*
+dse_line_string_iterator_init(DseLineStringIteratorStorage* storage);
+
+/**
+ * Destroys a line string iterator created using dse_line_string_iterator_init().
+ * The storage is not freed.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ */
+DSE_EXPORT void
+dse_line_string_iterator_destroy(DseLineStringIterator* iterator);
+
+/**
+ * Resets a line string iterator so that it can be reused.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_iterator_reset(DseLineStringIterator* iterator,
+                               const CassValue* value);
+
+/**
+ * Gets the number of points in the line string.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ * @return The number of points in the line string.
+ */
+DSE_EXPORT cass_uint32_t
+dse_line_string_iterator_num_points(const DseLineStringIterator* iterator);
+
+/**
+ * Gets the next point in the line string.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ * @param[out] x
+ * @param[out] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_iterator_next_point(DseLineStringIterator* iterator,
+                                    cass_double_t* x, cass_double_t* y);
+
+/**
+ * Gets the remaining points in the line string without copying them.
+ *
+ * The points are only valid until the iterator is reset, destroyed or freed.
+ * For iterators reset from a CassValue they point directly into the value's
+ * buffer and are also only valid while the value is alive. For iterators
+ * reset from a graph result using dse_graph_result_as_line_string() they
+ * point into the iterator's own buffer.
+ *
+ * The points are interleaved x and y coordinates (x0, y0, x1, y1, ...) of
+ * 8 bytes each in the platform's native byte order. They are not aligned for
+ * doubles so each coordinate must be read using memcpy().
+ *
+ * <b>Note:</b> This is only possible if the line string is encoded using the
+ * platform's native byte order. Use
+ * dse_line_string_iterator_next_points_copy() if this function returns
+ * CASS_ERROR_LIB_NOT_IMPLEMENTED.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ * @param[out] points
+ * @param[out] num_points
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_line_string_iterator_next_points_copy()
+ */
+DSE_EXPORT CassError
+dse_line_string_iterator_next_points(DseLineStringIterator* iterator,
+                                     const cass_byte_t** points,
+                                     cass_uint32_t* num_points);
+
+/**
+ * Copies the remaining points in the line string into the provided buffer as
+ * interleaved x and y coordinates (x0, y0, x1, y1, ...).
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ * @param[out] output A buffer large enough to hold 2 * the number of points
+ * returned by dse_line_string_iterator_num_points().
+ * @param[out] num_points The number of points copied.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_line_string_iterator_next_points_copy(DseLineStringIterator* iterator,
+                                          cass_double_t* output,
+                                          cass_uint32_t* num_points);
+
+/**
+ * Computes the bounding box of all the points in the line string. This
+ * doesn't change the position of the iterator.
+ *
+ * @public @memberof DseLineStringIterator
+ *
+ * @param[in] iterator
+ * @param[out] min_x
+ * @param[out] min_y
+ * @param[out] max_x
+ * @param[out] max_y
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if the line string is empty or the iterator
+ * hasn't been reset.
+ */
+DSE_EXPORT CassError
+dse_line_string_iterator_envelope(const DseLineStringIterator* iterator,
+                                  cass_double_t* min_x, cass_double_t* min_y,
+                                  cass_double_t* max_x, cass_double_t* max_y);
+
+/***********************************************************************************
+ *
+ * Polygon
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new polygon iterator.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @return Returns an polygon that must be freed.
+ *
+ * @see dse_polygon_iterator_free()
+ */
+DSE_EXPORT DsePolygon*
+dse_polygon_new();
+
+/**
+ * Frees a polygon instance.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ */
+DSE_EXPORT void
+dse_polygon_free(DsePolygon* polygon);
+
+/**
+ * Resets a polygon so that it can be reused.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ */
+DSE_EXPORT void
+dse_polygon_reset(DsePolygon* polygon);
+
+/**
+ * Reserves enough memory to contain the provided number rings and points. This can
+ * be use to reduce memory allocations, but it is not required.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] num_rings
+ * @param[in] total_num_points
+ */
+DSE_EXPORT void
+dse_polygon_reserve(DsePolygon* polygon,
+                    cass_uint32_t num_rings,
+                    cass_uint32_t total_num_points);
+
+/**
+ * Starts a new ring.
+ *
+ * <b>Note:</b> This will finish the previous ring.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_start_ring(DsePolygon* polygon);
+
+/**
+ * Adds a point to the current ring.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_add_point(DsePolygon* polygon,
+                      cass_double_t x, cass_double_t y);
+
+/**
+ * Adds multiple points to the current ring. The points are copied directly
+ * into the polygon's buffer which is much faster than calling
+ * dse_polygon_add_point() for each point.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] points An array of interleaved x and y coordinates
+ * (x0, y0, x1, y1, ...). It must contain 2 * num_points values.
+ * @param[in] num_points
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_add_points_n(DsePolygon* polygon,
+                         const cass_double_t* points,
+                         size_t num_points);
+
+/**
+ * Same as dse_polygon_add_points_n(), but with separate arrays for the
+ * x and y coordinates.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] x An array of num_points x coordinates
+ * @param[in] y An array of num_points y coordinates
+ * @param[in] num_points
+ * @return same as dse_polygon_add_points_n()
+ *
+ * @see dse_polygon_add_points_n()
+ */
+DSE_EXPORT CassError
+dse_polygon_add_points_xy_n(DsePolygon* polygon,
+                            const cass_double_t* x,
+                            const cass_double_t* y,
+                            size_t num_points);
+
+/**
+ * Finishes the contruction of a polygon.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_finish(DsePolygon* polygon);
+
+/**
+ * Replaces the contents of a polygon with a polygon parsed from well-known
+ * text (WKT) e.g. "POLYGON ((0 0, 1 0, 1 1, 0 0))". The polygon is finished
+ * and ready to be bound.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] wkt
+ * @return CASS_OK if successful, otherwise an error occurred. The polygon is
+ * reset if the text is not a valid polygon.
+ */
+DSE_EXPORT CassError
+dse_polygon_from_wkt(DsePolygon* polygon,
+                     const char* wkt);
+
+/**
+ * Same as dse_polygon_from_wkt(), but with lengths for string parameters.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] wkt
+ * @param[in] wkt_length
+ * @return same as dse_polygon_from_wkt()
+ *
+ * @see dse_polygon_from_wkt()
+ */
+DSE_EXPORT CassError
+dse_polygon_from_wkt_n(DsePolygon* polygon,
+                       const char* wkt,
+                       size_t wkt_length);
+
+/**
+ * Gets the bounding box of the points added to all the rings of a polygon.
+ * The bounding box is maintained as points are added so this doesn't
+ * require a pass over the points.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[out] min_x
+ * @param[out] min_y
+ * @param[out] max_x
+ * @param[out] max_y
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if no points have been added.
+ */
+DSE_EXPORT CassError
+dse_polygon_envelope(const DsePolygon* polygon,
+                     cass_double_t* min_x, cass_double_t* min_y,
+                     cass_double_t* max_x, cass_double_t* max_y);
+
+/**
+ * Removes points from each ring of a polygon that are within a distance of
+ * the simplified ring (Douglas-Peucker). Rings that would be left with too
+ * few points to be closed are not changed. The polygon must be finished.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] tolerance The largest distance, in the units of the coordinates,
+ * that a removed point can be from the simplified ring.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_line_string_simplify()
+ */
+DSE_EXPORT CassError
+dse_polygon_simplify(DsePolygon* polygon,
+                     cass_double_t tolerance);
+
+/**
+ * Determines if a point is inside of a polygon. Holes are handled using the
+ * even-odd rule and points that lie exactly on an edge may be reported as
+ * either inside or outside. The polygon must be finished.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] x
+ * @param[in] y
+ * @param[out] contains
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_contains_point(const DsePolygon* polygon,
+                           cass_double_t x, cass_double_t y,
+                           cass_bool_t* contains);
+
+/**
+ * Determines if a polygon and a box share any points. The polygon must be
+ * finished.
+ *
+ * @public @memberof DsePolygon
+ *
+ * @param[in] polygon
+ * @param[in] min_x
+ * @param[in] min_y
+ * @param[in] max_x
+ * @param[in] max_y
+ * @param[out] intersects
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_intersects_box(const DsePolygon* polygon,
+                           cass_double_t min_x, cass_double_t min_y,
+                           cass_double_t max_x, cass_double_t max_y,
+                           cass_bool_t* intersects);
+
+/***********************************************************************************
+ *
+ * Polygon Iterator
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new polygon iterator.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @return Returns an iterator that must be freed.
+ *
+ * @see dse_polygon_iterator_free()
+ */
+DSE_EXPORT DsePolygonIterator*
+dse_polygon_iterator_new();
+
+/**
+ * Frees a polygon iterator instance.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ */
+DSE_EXPORT void
+dse_polygon_iterator_free(DsePolygonIterator* iterator);
+
+/**
+ * Creates a new polygon iterator in storage provided by the caller instead
+ * of allocating it on the heap. This avoids allocations when an iterator is
+ * only needed briefly e.g. in a loop over rows.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] storage
+ * @return Returns an iterator that must be destroyed before the storage is
+ * reused or goes out of scope.
+ *
+ * @see dse_polygon_iterator_destroy()
+ */
+DSE_EXPORT DsePolygonIterator*
+dse_polygon_iterator_init(DsePolygonIteratorStorage* storage);
+
+/**
+ * Destroys a polygon iterator created using dse_polygon_iterator_init().
+ * The storage is not freed.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ */
+DSE_EXPORT void
+dse_polygon_iterator_destroy(DsePolygonIterator* iterator);
+
+/**
+ * Resets a polygon iterator so that it can be reused.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_reset(DsePolygonIterator* iterator,
+                           const CassValue* value);
+
+/**
+ * Same as dse_polygon_iterator_reset(), but only the header of the value is
+ * checked so the reset takes constant time. This is faster for values that
+ * are known to be valid e.g. values written by the application itself. The
+ * rings are still checked against the end of the value as they're iterated
+ * and CASS_ERROR_LIB_NOT_ENOUGH_DATA is returned for a truncated ring.
+ * Debug builds fully validate the value and abort if it's invalid.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_polygon_iterator_reset()
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_reset_trusted(DsePolygonIterator* iterator,
+                                   const CassValue* value);
+
+/**
+ * Gets the number rings in the polygon.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @return The number of rings in the polygon.
+ */
+DSE_EXPORT cass_uint32_t
+dse_polygon_iterator_num_rings(const DsePolygonIterator* iterator);
+
+/**
+ * Gets the number of points for the current ring.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[out] num_points
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_next_num_points(DsePolygonIterator* iterator,
+                                     cass_uint32_t* num_points);
+
+/**
+ * Moves the iterator to the start of a ring without visiting the points of
+ * the rings before it. The next call must be to
+ * dse_polygon_iterator_next_num_points(). Rings can be revisited.
+ *
+ * <b>Note:</b> The first call to this function or
+ * dse_polygon_iterator_ring_num_points() after a reset builds an index of
+ * the rings, which allocates memory. Iterating the rings in order doesn't.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[in] ring_index The index of the ring where 0 is the exterior ring.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_seek_ring(DsePolygonIterator* iterator,
+                               cass_uint32_t ring_index);
+
+/**
+ * Gets the number of points in any ring. This doesn't change the position of
+ * the iterator.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[in] ring_index The index of the ring where 0 is the exterior ring.
+ * @param[out] num_points
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_ring_num_points(const DsePolygonIterator* iterator,
+                                     cass_uint32_t ring_index,
+                                     cass_uint32_t* num_points);
+
+/**
+ * Gets the next point in the current ring.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[out] x
+ * @param[out] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_next_point(DsePolygonIterator* iterator,
+                                cass_double_t* x, cass_double_t* y);
+
+/**
+ * Gets the remaining points in the current ring without copying them and
+ * advances to the next ring.
+ *
+ * The points are only valid until the iterator is reset, destroyed or freed.
+ * For iterators reset from a CassValue they point directly into the value's
+ * buffer and are also only valid while the value is alive. For iterators
+ * reset from a graph result using dse_graph_result_as_polygon() they point
+ * into the iterator's own buffer.
+ *
+ * The points are interleaved x and y coordinates (x0, y0, x1, y1, ...) of
+ * 8 bytes each in the platform's native byte order. They are not aligned for
+ * doubles so each coordinate must be read using memcpy().
+ *
+ * <b>Note:</b> This is only possible if the polygon is encoded using the
+ * platform's native byte order. Use dse_polygon_iterator_next_points_copy() if
+ * this function returns CASS_ERROR_LIB_NOT_IMPLEMENTED.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[out] points
+ * @param[out] num_points
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_polygon_iterator_next_points_copy()
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_next_points(DsePolygonIterator* iterator,
+                                 const cass_byte_t** points,
+                                 cass_uint32_t* num_points);
+
+/**
+ * Copies the remaining points in the current ring into the provided buffer
+ * as interleaved x and y coordinates (x0, y0, x1, y1, ...) and advances to
+ * the next ring.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[out] output A buffer large enough to hold 2 * the number of points
+ * returned by dse_polygon_iterator_next_num_points().
+ * @param[out] num_points The number of points copied.
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_next_points_copy(DsePolygonIterator* iterator,
+                                      cass_double_t* output,
+                                      cass_uint32_t* num_points);
+
+/**
+ * Computes the bounding box of the points in all the rings of the polygon.
+ * This doesn't change the position of the iterator.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[out] min_x
+ * @param[out] min_y
+ * @param[out] max_x
+ * @param[out] max_y
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if the polygon is empty or the iterator
+ * hasn't been reset.
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_envelope(const DsePolygonIterator* iterator,
+                              cass_double_t* min_x, cass_double_t* min_y,
+                              cass_double_t* max_x, cass_double_t* max_y);
+
+/**
+ * Determines if a point is inside of the polygon without decoding the
+ * polygon. This doesn't change the position of the iterator.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[in] x
+ * @param[in] y
+ * @param[out] contains
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_polygon_contains_point()
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_contains_point(const DsePolygonIterator* iterator,
+                                    cass_double_t x, cass_double_t y,
+                                    cass_bool_t* contains);
+
+/**
+ * Determines if the polygon and a box share any points without decoding the
+ * polygon. This doesn't change the position of the iterator.
+ *
+ * @public @memberof DsePolygonIterator
+ *
+ * @param[in] iterator
+ * @param[in] min_x
+ * @param[in] min_y
+ * @param[in] max_x
+ * @param[in] max_y
+ * @param[out] intersects
+ * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_polygon_intersects_box()
+ */
+DSE_EXPORT CassError
+dse_polygon_iterator_intersects_box(const DsePolygonIterator* iterator,
+                                    cass_double_t min_x, cass_double_t min_y,
+                                    cass_double_t max_x, cass_double_t max_y,
+                                    cass_bool_t* intersects);
+
+/***********************************************************************************
+ *
+ * Multi Point
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new multi point.
+ *
+ * @public @memberof DseMultiPoint
+ *
+ * @return Returns a multi point that must be freed.
+ *
+ * @see dse_multi_point_free()
+ */
+DSE_EXPORT DseMultiPoint*
+dse_multi_point_new();
+
+/**
+ * Frees a multi point instance.
+ *
+ * @public @memberof DseMultiPoint
+ *
+ * @param[in] multi_point
+ */
+DSE_EXPORT void
+dse_multi_point_free(DseMultiPoint* multi_point);
+
+/**
+ * Resets a multi point so that it can be reused.
+ *
+ * @public @memberof DseMultiPoint
+ *
+ * @param[in] multi_point
+ */
+DSE_EXPORT void
+dse_multi_point_reset(DseMultiPoint* multi_point);
+
+/**
+ * Reserves enough memory to contain the provided number of points. This can
+ * be use to reduce memory allocations, but it is not required.
+ *
+ * @public @memberof DseMultiPoint
+ *
+ * @param[in] multi_point
+ * @param[in] num_points
+ */
+DSE_EXPORT void
+dse_multi_point_reserve(DseMultiPoint* multi_point,
+                        cass_uint32_t num_points);
+
+/**
+ * Adds a point to the multi point.
+ *
+ * @public @memberof DseMultiPoint
+ *
+ * @param[in] multi_point
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_multi_point_add_point(DseMultiPoint* multi_point,
+                          cass_double_t x, cass_double_t y);
+
+/**
+ * Finishes the contruction of a multi point.
+ *
+ * @public @memberof DseMultiPoint
+ *
+ * @param[in] multi_point
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_multi_point_finish(DseMultiPoint* multi_point);
+
+/***********************************************************************************
+ *
+ * Multi Point Iterator
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new multi point iterator.
+ *
+ * @public @memberof DseMultiPointIterator
+ *
+ * @return Returns an iterator that must be freed.
+ *
+ * @see dse_multi_point_iterator_free()
+ */
+DSE_EXPORT DseMultiPointIterator*
+dse_multi_point_iterator_new();
+
+/**
+ * Frees a multi point iterator instance.
+ *
+ * @public @memberof DseMultiPointIterator
+ *
+ * @param[in] iterator
+ */
+DSE_EXPORT void
+dse_multi_point_iterator_free(DseMultiPointIterator* iterator);
+
+/**
+ * Resets a multi point iterator so that it can be reused.
+ *
+ * @public @memberof DseMultiPointIterator
+ *
+ * @param[in] iterator
+ * @param[in] value
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_multi_point_iterator_reset(DseMultiPointIterator* iterator,
+                               const CassValue* value);
+
+/**
+ * Gets the number of points in the multi point.
+ *
+ * @public @memberof DseMultiPointIterator
+ *
+ * @param[in] iterator
+ * @return The number of points in the multi point.
+ */
+DSE_EXPORT cass_uint32_t
+dse_multi_point_iterator_num_points(const DseMultiPointIterator* iterator);
+
+/**
+ * Gets the next point in the multi point.
+ *
+ * @public @memberof DseMultiPointIterator
+ *
+ * @param[in] iterator
+ * @param[out] x
+ * @param[out] y
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_multi_point_iterator_next_point(DseMultiPointIterator* iterator,
+                                    cass_double_t* x, cass_double_t* y);
+
+/***********************************************************************************
+ *
+ * Multi Line String
+ *
+ ***********************************************************************************/
 
 /**
- * Get the integer (32-bit) value from the result.
+ * Creates a new multi line string.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @return The integer (32-bit) value.
+ * @return Returns a multi line string that must be freed.
+ *
+ * @see dse_multi_line_string_free()
  */
-DSE_EXPORT cass_int32_t
-dse_graph_result_get_int32(const DseGraphResult* result);
+DSE_EXPORT DseMultiLineString*
+dse_multi_line_string_new();
 
 /**
- * Get the integer (64-bit) value from the result.
+ * Frees a multi line string instance.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @return The integer (64-bit) value.
+ * @param[in] multi_line_string
  */
-DSE_EXPORT cass_int64_t
-dse_graph_result_get_int64(const DseGraphResult* result);
+DSE_EXPORT void
+dse_multi_line_string_free(DseMultiLineString* multi_line_string);
 
 /**
- * Get the double value from the result.
+ * Resets a multi line string so that it can be reused.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @return The double value.
+ * @param[in] multi_line_string
  */
-DSE_EXPORT cass_double_t
-dse_graph_result_get_double(const DseGraphResult* result);
+DSE_EXPORT void
+dse_multi_line_string_reset(DseMultiLineString* multi_line_string);
 
 /**
- * Get the string value from the result.
+ * Reserves enough memory to contain the provided number of line strings and
+ * points. This can be use to reduce memory allocations, but it is not required.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @param[out] length
- * @return The string value.
+ * @param[in] multi_line_string
+ * @param[in] num_line_strings
+ * @param[in] total_num_points The total number of points in all line strings
  */
-DSE_EXPORT const char*
-dse_graph_result_get_string(const DseGraphResult* result,
-                            size_t* length);
+DSE_EXPORT void
+dse_multi_line_string_reserve(DseMultiLineString* multi_line_string,
+                              cass_uint32_t num_line_strings,
+                              cass_uint32_t total_num_points);
 
 /**
- * Return an object as an graph edge.
+ * Starts a new line string. This finishes the previous line string.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @param[out] edge
+ * @param[in] multi_line_string
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_result_as_edge(const DseGraphResult* result,
-                         DseGraphEdgeResult* edge);
+dse_multi_line_string_start_line_string(DseMultiLineString* multi_line_string);
 
 /**
- * Return an object as an graph vertex.
+ * Adds a point to the current line string.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @param[out] vertex
+ * @param[in] multi_line_string
+ * @param[in] x
+ * @param[in] y
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_result_as_vertex(const DseGraphResult* result,
-                           DseGraphVertexResult* vertex);
+dse_multi_line_string_add_point(DseMultiLineString* multi_line_string,
+                                cass_double_t x, cass_double_t y);
 
 /**
- * Return an object as an graph path.
+ * Finishes the contruction of a multi line string.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineString
  *
- * @param[in] result
- * @param[out] path
+ * @param[in] multi_line_string
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_result_as_path(const DseGraphResult* result,
-                         DseGraphPathResult* path);
+dse_multi_line_string_finish(DseMultiLineString* multi_line_string);
+
+/***********************************************************************************
+ *
+ * Multi Line String Iterator
+ *
+ ***********************************************************************************/
 
 /**
- * Return an object as the point geometric type.
+ * Creates a new multi line string iterator.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineStringIterator
  *
- * @param[in] result
- * @param[out] x
- * @param[out] y
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @return Returns an iterator that must be freed.
+ *
+ * @see dse_multi_line_string_iterator_free()
  */
-DSE_EXPORT CassError
-dse_graph_result_as_point(const DseGraphResult* result,
-                          cass_double_t* x, cass_double_t* y);
+DSE_EXPORT DseMultiLineStringIterator*
+dse_multi_line_string_iterator_new();
 
 /**
- * Return an object as the line string geometric type.
+ * Frees a multi line string iterator instance.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineStringIterator
  *
- * @param[in] result
- * @param[out] line_string
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @param[in] iterator
  */
-DSE_EXPORT CassError
-dse_graph_result_as_line_string(const DseGraphResult* result,
-                                DseLineStringIterator* line_string);
+DSE_EXPORT void
+dse_multi_line_string_iterator_free(DseMultiLineStringIterator* iterator);
 
 /**
- * Return an object as the polygon geometric type.
+ * Resets a multi line string iterator so that it can be reused.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineStringIterator
  *
- * @param[in] result
- * @param[out] polygon
+ * @param[in] iterator
+ * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_graph_result_as_polygon(const DseGraphResult* result,
-                            DsePolygonIterator* polygon);
+dse_multi_line_string_iterator_reset(DseMultiLineStringIterator* iterator,
+                                     const CassValue* value);
 
 /**
- * Returns the number of members in an object result.
+ * Gets the number of line strings in the multi line string.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineStringIterator
  *
- * @param[in] result
- * @return The number of members in an object result.
+ * @param[in] iterator
+ * @return The number of line strings in the multi line string.
  */
-DSE_EXPORT size_t
-dse_graph_result_member_count(const DseGraphResult* result);
+DSE_EXPORT cass_uint32_t
+dse_multi_line_string_iterator_num_line_strings(const DseMultiLineStringIterator* iterator);
 
 /**
- * Return the string key of an object at the specified index.
+ * Resets the provided line string iterator to the next line string in the
+ * multi line string. The line string iterator is only valid for the lifetime
+ * of the multi line string iterator's value.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiLineStringIterator
  *
- * @param[in] result
- * @param[in] index
- * @param[out] length
- * @return The string key of the member.
+ * @param[in] iterator
+ * @param[out] line_string
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT const char*
-dse_graph_result_member_key(const DseGraphResult* result,
-                            size_t index,
-                            size_t* length);
+DSE_EXPORT CassError
+dse_multi_line_string_iterator_next_line_string(DseMultiLineStringIterator* iterator,
+                                                DseLineStringIterator* line_string);
+
+/***********************************************************************************
+ *
+ * Multi Polygon
+ *
+ ***********************************************************************************/
 
 /**
- * Return the result value of an object at the specified index.
+ * Creates a new multi polygon.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] result
- * @param[in] index
+ * @return Returns a multi polygon that must be freed.
  *
- * @return The result value of the member.
+ * @see dse_multi_polygon_free()
  */
-DSE_EXPORT const DseGraphResult*
-dse_graph_result_member_value(const DseGraphResult* result,
-                              size_t index);
+DSE_EXPORT DseMultiPolygon*
+dse_multi_polygon_new();
 
 /**
- * Returns the number of elements in an array result.
+ * Frees a multi polygon instance.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] result
- * @return The number of elements in array result.
+ * @param[in] multi_polygon
  */
-DSE_EXPORT size_t
-dse_graph_result_element_count(const DseGraphResult* result);
+DSE_EXPORT void
+dse_multi_polygon_free(DseMultiPolygon* multi_polygon);
 
 /**
- * Returns the result value of an array at the specified index.
+ * Resets a multi polygon so that it can be reused.
  *
- * @public @memberof DseGraphResult
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] result
- * @param[in] index
- * @return The result value.
+ * @param[in] multi_polygon
  */
-DSE_EXPORT const DseGraphResult*
-dse_graph_result_element(const DseGraphResult* result,
-                         size_t index);
+DSE_EXPORT void
+dse_multi_polygon_reset(DseMultiPolygon* multi_polygon);
 
-/***********************************************************************************
+/**
+ * Reserves enough memory to contain the provided number of polygons, rings
+ * and points. This can be use to reduce memory allocations, but it is not
+ * required.
  *
- * Statement
+ * @public @memberof DseMultiPolygon
  *
- ***********************************************************************************/
+ * @param[in] multi_polygon
+ * @param[in] num_polygons
+ * @param[in] total_num_rings The total number of rings in all polygons
+ * @param[in] total_num_points The total number of points in all rings
+ */
+DSE_EXPORT void
+dse_multi_polygon_reserve(DseMultiPolygon* multi_polygon,
+                          cass_uint32_t num_polygons,
+                          cass_uint32_t total_num_rings,
+                          cass_uint32_t total_num_points);
 
 /**
- * Binds point to a query or bound statement at the specified index.
+ * Starts a new polygon. This finishes the previous polygon.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] statement
- * @param[in] index
- * @param[in] x
- * @param[in] y
+ * @param[in] multi_polygon
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-cass_statement_bind_dse_point(CassStatement* statement,
-                              size_t index,
-                              cass_double_t x, cass_double_t y);
+dse_multi_polygon_start_polygon(DseMultiPolygon* multi_polygon);
 
 /**
- * Binds a point to all the values with the specified name.
+ * Starts a new ring in the current polygon. This finishes the previous ring.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] statement
- * @param[in] name
- * @param[in] x
- * @param[in] y
+ * @param[in] multi_polygon
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-cass_statement_bind_dse_point_by_name(CassStatement* statement,
-                                      const char* name,
-                                      cass_double_t x, cass_double_t y);
+dse_multi_polygon_start_ring(DseMultiPolygon* multi_polygon);
 
 /**
- * Same as cass_statement_bind_dse_point_by_name(), but with lengths for string
- * parameters.
+ * Adds a point to the current ring.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] statement
- * @param[in] name
- * @param[in] name_length
+ * @param[in] multi_polygon
  * @param[in] x
  * @param[in] y
- * @return same as cass_statement_bind_dse_point_by_name()
- *
- * @see cass_statement_bind_dse_point_by_name()
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-cass_statement_bind_dse_point_by_name_n(CassStatement* statement,
-                                        const char* name, size_t name_length,
-                                        cass_double_t x, cass_double_t y);
+dse_multi_polygon_add_point(DseMultiPolygon* multi_polygon,
+                            cass_double_t x, cass_double_t y);
 
 /**
- * Binds line string to a query or bound statement at the specified index.
+ * Finishes the contruction of a multi polygon.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygon
  *
- * @param[in] statement
- * @param[in] index
- * @param[in] line_string
+ * @param[in] multi_polygon
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-cass_statement_bind_dse_line_string(CassStatement* statement,
-                                    size_t index,
-                                    const DseLineString* line_string);
+dse_multi_polygon_finish(DseMultiPolygon* multi_polygon);
 
-/**
- * Binds a line string to all the values with the specified name.
+/***********************************************************************************
  *
- * @public @memberof CassStatement
+ * Multi Polygon Iterator
  *
- * @param[in] statement
- * @param[in] name
- * @param[in] line_string
- * @return CASS_OK if successful, otherwise an error occurred.
- */
-DSE_EXPORT CassError
-cass_statement_bind_dse_line_string_by_name(CassStatement* statement,
-                                            const char* name,
-                                            const DseLineString* line_string);
+ ***********************************************************************************/
 
 /**
- * Same as cass_statement_bind_dse_line_string_by_name(), but with lengths for string
- * parameters.
+ * Creates a new multi polygon iterator.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygonIterator
  *
- * @param[in] statement
- * @param[in] name
- * @param[in] name_length
- * @param[in] line_string
- * @return same as cass_statement_bind_dse_line_string_by_name()
+ * @return Returns an iterator that must be freed.
  *
- * @see cass_statement_bind_dse_line_string_by_name()
+ * @see dse_multi_polygon_iterator_free()
  */
-DSE_EXPORT CassError
-cass_statement_bind_dse_line_string_by_name_n(CassStatement* statement,
-                                              const char* name, size_t name_length,
-                                              const DseLineString* line_string);
+DSE_EXPORT DseMultiPolygonIterator*
+dse_multi_polygon_iterator_new();
 
 /**
- * Binds polygon to a query or bound statement at the specified index.
+ * Frees a multi polygon iterator instance.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygonIterator
  *
- * @param[in] statement
- * @param[in] index
- * @param[in] polygon
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @param[in] iterator
  */
-DSE_EXPORT CassError
-cass_statement_bind_dse_polygon(CassStatement* statement,
-                                size_t index,
-                                const DsePolygon* polygon);
+DSE_EXPORT void
+dse_multi_polygon_iterator_free(DseMultiPolygonIterator* iterator);
 
 /**
- * Binds a polygon to all the values with the specified name.
+ * Resets a multi polygon iterator so that it can be reused.
  *
- * @public @memberof CassStatement
+ * @public @memberof DseMultiPolygonIterator
  *
- * @param[in] statement
- * @param[in] name
- * @param[in] polygon
+ * @param[in] iterator
+ * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT CassError
-cass_statement_bind_dse_polygon_by_name(CassStatement* statement,
-                                        const char* name,
-                                        const DsePolygon* polygon);
-
-/**
- * Same as cass_statement_bind_dse_polygon_by_name(), but with lengths for string
- * parameters.
- *
- * @public @memberof CassStatement
- *
- * @param[in] statement
- * @param[in] name
- * @param[in] name_length
- * @param[in] polygon
- * @return same as cass_statement_bind_dse_polygon_by_name()
- *
- * @see cass_statement_bind_dse_polygon_by_name()
- */
-DSE_EXPORT CassError
-cass_statement_bind_dse_polygon_by_name_n(CassStatement* statement,
-                                          const char* name, size_t name_length,
-                                          const DsePolygon* polygon);
+DSE_EXPORT CassError
+dse_multi_polygon_iterator_reset(DseMultiPolygonIterator* iterator,
+                                 const CassValue* value);
 
-/***********************************************************************************
+/**
+ * Gets the number of polygons in the multi polygon.
  *
- * Value
+ * @public @memberof DseMultiPolygonIterator
  *
- ***********************************************************************************/
+ * @param[in] iterator
+ * @return The number of polygons in the multi polygon.
+ */
+DSE_EXPORT cass_uint32_t
+dse_multi_polygon_iterator_num_polygons(const DseMultiPolygonIterator* iterator);
 
 /**
- * Gets a point for the specified value.
+ * Resets the provided polygon iterator to the next polygon in the multi
+ * polygon. The polygon iterator is only valid for the lifetime of the multi
+ * polygon iterator's value.
  *
- * @public @memberof CassValue
+ * @public @memberof DseMultiPolygonIterator
  *
- * @param[in] value
- * @param[out] x
- * @param[out] y
- * @return CASS_OK if successful, otherwise error occurred
+ * @param[in] iterator
+ * @param[out] polygon
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-cass_value_get_dse_point(const CassValue* value,
-                         cass_double_t* x, cass_double_t* y);
+dse_multi_polygon_iterator_next_polygon(DseMultiPolygonIterator* iterator,
+                                        DsePolygonIterator* polygon);
 
 /***********************************************************************************
  *
- * Line String
+ * Geometry Collection
  *
  ***********************************************************************************/
 
 /**
- * Creates a new line string.
+ * Creates a new geometry collection.
  *
- * @public @memberof DseLineString
+ * @public @memberof DseGeometryCollection
  *
- * @return Returns a line string that must be freed.
+ * @return Returns a geometry collection that must be freed.
  *
- * @see dse_line_string_free()
+ * @see dse_geometry_collection_free()
  */
-DSE_EXPORT DseLineString*
-dse_line_string_new();
+DSE_EXPORT DseGeometryCollection*
+dse_geometry_collection_new();
 
 /**
- * Frees a line string instance.
+ * Frees a geometry collection instance.
  *
- * @public @memberof DseLineString
+ * @public @memberof DseGeometryCollection
  *
- * @param[in] line_string
+ * @param[in] collection
  */
 DSE_EXPORT void
-dse_line_string_free(DseLineString* line_string);
+dse_geometry_collection_free(DseGeometryCollection* collection);
 
 /**
- * Resets a line string so that it can be reused.
+ * Resets a geometry collection so that it can be reused.
  *
- * @public @memberof DseLineString
+ * @public @memberof DseGeometryCollection
  *
- * @param[in] line_string
+ * @param[in] collection
  */
 DSE_EXPORT void
-dse_line_string_reset(DseLineString* line_string);
+dse_geometry_collection_reset(DseGeometryCollection* collection);
 
 /**
- * Reserves enough memory to contain the provided number of points. This can
- * be use to reduce memory allocations, but it is not required.
+ * Adds a point to the geometry collection.
  *
- * @public @memberof DseLineString
+ * @public @memberof DseGeometryCollection
  *
- * @param[in] line_string
- * @param[in] num_points
+ * @param[in] collection
+ * @param[in] x
+ * @param[in] y
+ * @return CASS_OK if successful, otherwise an error occurred.
  */
-DSE_EXPORT void
-dse_line_string_reserve(DseLineString* line_string,
-                        cass_uint32_t num_points);
+DSE_EXPORT CassError
+dse_geometry_collection_add_point(DseGeometryCollection* collection,
+                                  cass_double_t x, cass_double_t y);
 
 /**
- * Adds a point to the line string.
+ * Adds a copy of a finished line string to the geometry collection.
  *
- * @public @memberof DseLineString
+ * @public @memberof DseGeometryCollection
  *
+ * @param[in] collection
  * @param[in] line_string
- * @param[in] x
- * @param[in] y
  * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_line_string_finish()
  */
 DSE_EXPORT CassError
-dse_line_string_add_point(DseLineString* line_string,
-                          cass_double_t x, cass_double_t y);
+dse_geometry_collection_add_line_string(DseGeometryCollection* collection,
+                                        const DseLineString* line_string);
 
 /**
- * Finishes the contruction of a line string.
+ * Adds a copy of a finished polygon to the geometry collection.
  *
- * @public @memberof DseLineString
+ * @public @memberof DseGeometryCollection
  *
- * @param[in] line_string
+ * @param[in] collection
+ * @param[in] polygon
  * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_polygon_finish()
  */
 DSE_EXPORT CassError
-dse_line_string_finish(DseLineString* line_string);
+dse_geometry_collection_add_polygon(DseGeometryCollection* collection,
+                                    const DsePolygon* polygon);
+
+/**
+ * Finishes the contruction of a geometry collection.
+ *
+ * @public @memberof DseGeometryCollection
+ *
+ * @param[in] collection
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_geometry_collection_finish(DseGeometryCollection* collection);
 
 /***********************************************************************************
  *
- * Line String Iterator
+ * Geometry Collection Iterator
  *
  ***********************************************************************************/
 
 /**
- * Creates a new line string iterator.
+ * Creates a new geometry collection iterator.
  *
- * @public @memberof DseLineStringIterator
+ * @public @memberof DseGeometryCollectionIterator
  *
  * @return Returns an iterator that must be freed.
  *
- * @see dse_line_string_iterator_free()
+ * @see dse_geometry_collection_iterator_free()
  */
-DSE_EXPORT DseLineStringIterator*
-dse_line_string_iterator_new();
+DSE_EXPORT DseGeometryCollectionIterator*
+dse_geometry_collection_iterator_new();
 
 /**
- * Frees a line string iterator instance.
+ * Frees a geometry collection iterator instance.
  *
- * @public @memberof DseLineStringIterator
+ * @public @memberof DseGeometryCollectionIterator
  *
  * @param[in] iterator
  */
 DSE_EXPORT void
-dse_line_string_iterator_free(DseLineStringIterator* iterator);
+dse_geometry_collection_iterator_free(DseGeometryCollectionIterator* iterator);
 
 /**
- * Resets a line string iterator so that it can be reused.
+ * Resets a geometry collection iterator so that it can be reused.
  *
- * @public @memberof DseLineStringIterator
+ * @public @memberof DseGeometryCollectionIterator
  *
  * @param[in] iterator
  * @param[in] value
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_line_string_iterator_reset(DseLineStringIterator* iterator,
-                               const CassValue* value);
+dse_geometry_collection_iterator_reset(DseGeometryCollectionIterator* iterator,
+                                       const CassValue* value);
 
 /**
- * Gets the number of points in the line string.
+ * Gets the number of geometries in the geometry collection.
  *
- * @public @memberof DseLineStringIterator
+ * @public @memberof DseGeometryCollectionIterator
  *
  * @param[in] iterator
- * @return The number of points in the line string.
+ * @return The number of geometries in the geometry collection.
  */
 DSE_EXPORT cass_uint32_t
-dse_line_string_iterator_num_points(const DseLineStringIterator* iterator);
+dse_geometry_collection_iterator_num_geometries(const DseGeometryCollectionIterator* iterator);
 
 /**
- * Gets the next point in the line string.
+ * Gets the type of the next geometry without advancing the iterator.
  *
- * @public @memberof DseLineStringIterator
+ * @public @memberof DseGeometryCollectionIterator
+ *
+ * @param[in] iterator
+ * @param[out] type
+ * @return CASS_OK if successful, otherwise an error occurred.
+ */
+DSE_EXPORT CassError
+dse_geometry_collection_iterator_next_type(const DseGeometryCollectionIterator* iterator,
+                                           DseGeometryType* type);
+
+/**
+ * Gets the next geometry as a point.
+ *
+ * @public @memberof DseGeometryCollectionIterator
  *
  * @param[in] iterator
  * @param[out] x
  * @param[out] y
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if the next geometry is not a point.
  */
 DSE_EXPORT CassError
-dse_line_string_iterator_next_point(DseLineStringIterator* iterator,
-                                    cass_double_t* x, cass_double_t* y);
+dse_geometry_collection_iterator_next_point(DseGeometryCollectionIterator* iterator,
+                                            cass_double_t* x, cass_double_t* y);
+
+/**
+ * Resets the provided line string iterator to the next geometry. The line
+ * string iterator is only valid for the lifetime of the geometry collection
+ * iterator's value.
+ *
+ * @public @memberof DseGeometryCollectionIterator
+ *
+ * @param[in] iterator
+ * @param[out] line_string
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if the next geometry is not a line string.
+ */
+DSE_EXPORT CassError
+dse_geometry_collection_iterator_next_line_string(DseGeometryCollectionIterator* iterator,
+                                                  DseLineStringIterator* line_string);
+
+/**
+ * Resets the provided polygon iterator to the next geometry. The polygon
+ * iterator is only valid for the lifetime of the geometry collection
+ * iterator's value.
+ *
+ * @public @memberof DseGeometryCollectionIterator
+ *
+ * @param[in] iterator
+ * @param[out] polygon
+ * @return CASS_OK if successful, otherwise an error occurred. Returns
+ * CASS_ERROR_LIB_INVALID_STATE if the next geometry is not a polygon.
+ */
+DSE_EXPORT CassError
+dse_geometry_collection_iterator_next_polygon(DseGeometryCollectionIterator* iterator,
+                                              DsePolygonIterator* polygon);
 
 /***********************************************************************************
  *
- * Polygon
+ * Geometry Arena
  *
  ***********************************************************************************/
 
 /**
- * Creates a new polygon iterator.
+ * Creates a new geometry arena. A geometry arena owns line string and polygon
+ * builders that are reused each time the arena is reset instead of being
+ * freed. This avoids allocations when large numbers of geometries are built
+ * in batches.
  *
- * @public @memberof DsePolygon
+ * @public @memberof DseGeometryArena
  *
- * @return Returns an polygon that must be freed.
+ * @return Returns a geometry arena that must be freed.
  *
- * @see dse_polygon_iterator_free()
+ * @see dse_geometry_arena_free()
  */
-DSE_EXPORT DsePolygon*
-dse_polygon_new();
+DSE_EXPORT DseGeometryArena*
+dse_geometry_arena_new();
 
 /**
- * Frees a polygon instance.
+ * Frees a geometry arena instance and all the builders it created.
  *
- * @public @memberof DsePolygon
+ * @public @memberof DseGeometryArena
  *
- * @param[in] polygon
+ * @param[in] arena
  */
 DSE_EXPORT void
-dse_polygon_free(DsePolygon* polygon);
+dse_geometry_arena_free(DseGeometryArena* arena);
 
 /**
- * Resets a polygon so that it can be reused.
+ * Makes all the builders created by the arena available to be reused. The
+ * builders previously returned by the arena must not be used after calling
+ * this function.
  *
- * @public @memberof DsePolygon
+ * @public @memberof DseGeometryArena
  *
- * @param[in] polygon
+ * @param[in] arena
  */
 DSE_EXPORT void
-dse_polygon_reset(DsePolygon* polygon);
+dse_geometry_arena_reset(DseGeometryArena* arena);
 
 /**
- * Reserves enough memory to contain the provided number rings and points. This can
- * be use to reduce memory allocations, but it is not required.
+ * Gets an empty line string builder from the arena.
  *
- * @public @memberof DsePolygon
+ * @public @memberof DseGeometryArena
  *
- * @param[in] polygon
- * @param[in] num_rings
- * @param[in] total_num_points
+ * @param[in] arena
+ * @return Returns a line string that is owned by the arena. It must not be
+ * freed using dse_line_string_free() and it is only valid until the arena is
+ * reset or freed.
  */
-DSE_EXPORT void
-dse_polygon_reserve(DsePolygon* polygon,
-                    cass_uint32_t num_rings,
-                    cass_uint32_t total_num_points);
+DSE_EXPORT DseLineString*
+dse_geometry_arena_new_line_string(DseGeometryArena* arena);
 
 /**
- * Starts a new ring.
+ * Gets an empty polygon builder from the arena.
  *
- * <b>Note:</b> This will finish the previous ring.
+ * @public @memberof DseGeometryArena
  *
- * @public @memberof DsePolygon
+ * @param[in] arena
+ * @return Returns a polygon that is owned by the arena. It must not be
+ * freed using dse_polygon_free() and it is only valid until the arena is
+ * reset or freed.
+ */
+DSE_EXPORT DsePolygon*
+dse_geometry_arena_new_polygon(DseGeometryArena* arena);
+
+/***********************************************************************************
  *
- * @param[in] polygon
- * @return CASS_OK if successful, otherwise an error occurred.
+ * Geometry Column
+ *
+ ***********************************************************************************/
+
+/**
+ * Creates a new geometry column. A geometry column decodes all the points of
+ * a point or line string column in a result into separate arrays of x and y
+ * coordinates.
+ *
+ * @public @memberof DseGeometryColumn
+ *
+ * @return Returns a geometry column that must be freed.
+ *
+ * @see dse_geometry_column_free()
  */
-DSE_EXPORT CassError
-dse_polygon_start_ring(DsePolygon* polygon);
+DSE_EXPORT DseGeometryColumn*
+dse_geometry_column_new();
 
 /**
- * Adds a point to the current ring.
+ * Frees a geometry column instance.
  *
- * @public @memberof DsePolygon
+ * @public @memberof DseGeometryColumn
  *
- * @param[in] polygon
- * @param[in] x
- * @param[in] y
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @param[in] column
  */
-DSE_EXPORT CassError
-dse_polygon_add_point(DsePolygon* polygon,
-                      cass_double_t x, cass_double_t y);
+DSE_EXPORT void
+dse_geometry_column_free(DseGeometryColumn* column);
 
 /**
- * Finishes the contruction of a polygon.
+ * Decodes the points of every row of a result's column. The column must be
+ * of type 'PointType' or 'LineStringType'. Null values are decoded as rows
+ * without any points. The geometry column can be reused for other results.
  *
- * @public @memberof DsePolygon
+ * @public @memberof DseGeometryColumn
  *
- * @param[in] polygon
+ * @param[in] column
+ * @param[in] result
+ * @param[in] index The index of the column in the result
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_polygon_finish(DsePolygon* polygon);
+dse_geometry_column_reset(DseGeometryColumn* column,
+                          const CassResult* result,
+                          size_t index);
 
-/***********************************************************************************
+/**
+ * Gets the number of rows in the geometry column.
  *
- * Polygon Iterator
+ * @public @memberof DseGeometryColumn
  *
- ***********************************************************************************/
+ * @param[in] column
+ * @return The number of rows.
+ */
+DSE_EXPORT size_t
+dse_geometry_column_num_rows(const DseGeometryColumn* column);
 
 /**
- * Creates a new polygon iterator.
- *
- * @public @memberof DsePolygonIterator
+ * Gets the total number of points in all rows of the geometry column.
  *
- * @return Returns an iterator that must be freed.
+ * @public @memberof DseGeometryColumn
  *
- * @see dse_polygon_iterator_free()
+ * @param[in] column
+ * @return The number of points.
  */
-DSE_EXPORT DsePolygonIterator*
-dse_polygon_iterator_new();
+DSE_EXPORT size_t
+dse_geometry_column_num_points(const DseGeometryColumn* column);
 
 /**
- * Frees a polygon iterator instance.
+ * Gets the x coordinates of all the points in the geometry column. The
+ * array is only valid until the geometry column is reset or freed.
  *
- * @public @memberof DsePolygonIterator
+ * @public @memberof DseGeometryColumn
  *
- * @param[in] iterator
+ * @param[in] column
+ * @return An array of dse_geometry_column_num_points() x coordinates.
  */
-DSE_EXPORT void
-dse_polygon_iterator_free(DsePolygonIterator* iterator);
+DSE_EXPORT const cass_double_t*
+dse_geometry_column_x(const DseGeometryColumn* column);
 
 /**
- * Resets a polygon iterator so that it can be reused.
+ * Gets the y coordinates of all the points in the geometry column. The
+ * array is only valid until the geometry column is reset or freed.
  *
- * @public @memberof DsePolygonIterator
+ * @public @memberof DseGeometryColumn
  *
- * @param[in] iterator
- * @param[in] value
- * @return CASS_OK if successful, otherwise an error occurred.
+ * @param[in] column
+ * @return An array of dse_geometry_column_num_points() y coordinates.
  */
-DSE_EXPORT CassError
-dse_polygon_iterator_reset(DsePolygonIterator* iterator,
-                           const CassValue* value);
+DSE_EXPORT const cass_double_t*
+dse_geometry_column_y(const DseGeometryColumn* column);
 
 /**
- * Gets the number rings in the polygon.
+ * Gets the offsets of each row's points. The points of row i are at indexes
+ * [offsets[i], offsets[i + 1]) of the x and y coordinate arrays. The
+ * array is only valid until the geometry column is reset or freed.
  *
- * @public @memberof DsePolygonIterator
+ * @public @memberof DseGeometryColumn
  *
- * @param[in] iterator
- * @return The number of rings in the polygon.
+ * @param[in] column
+ * @return An array of dse_geometry_column_num_rows() + 1 offsets.
  */
-DSE_EXPORT cass_uint32_t
-dse_polygon_iterator_num_rings(const DsePolygonIterator* iterator);
+DSE_EXPORT const size_t*
+dse_geometry_column_offsets(const DseGeometryColumn* column);
+
+/***********************************************************************************
+ *
+ * Geodesic Distance
+ *
+ ***********************************************************************************/
 
 /**
- * Gets the number of points for the current ring.
+ * Computes the great-circle distance between two points using the haversine
+ * formula. The x coordinates are longitudes and the y coordinates are
+ * latitudes in degrees.
  *
- * @public @memberof DsePolygonIterator
+ * @param[in] x1
+ * @param[in] y1
+ * @param[in] x2
+ * @param[in] y2
+ * @return The distance in meters.
+ */
+DSE_EXPORT cass_double_t
+dse_haversine_distance(cass_double_t x1, cass_double_t y1,
+                       cass_double_t x2, cass_double_t y2);
+
+/**
+ * Computes the great-circle distances between a point and an array of points
+ * e.g. the coordinates of a geometry column.
  *
- * @param[in] iterator
- * @param[out] num_points
+ * @param[in] x
+ * @param[in] y
+ * @param[in] xs
+ * @param[in] ys
+ * @param[in] num_points
+ * @param[out] distances An array of num_points distances in meters.
+ *
+ * @see dse_haversine_distance()
+ * @see dse_geometry_column_x()
+ * @see dse_geometry_column_y()
+ */
+DSE_EXPORT void
+dse_haversine_distance_n(cass_double_t x, cass_double_t y,
+                         const cass_double_t* xs, const cass_double_t* ys,
+                         size_t num_points,
+                         cass_double_t* distances);
+
+/***********************************************************************************
+ *
+ * Spatial Keys
+ *
+ ***********************************************************************************/
+
+/**
+ * Computes the Morton codes (Z-order) of an array of points. The points are
+ * mapped to the cells of a 2^32 x 2^32 grid covering the provided bounds and
+ * the bits of the cells' x and y indexes are interleaved starting with x.
+ * Points outside of the bounds are clamped to the nearest edge. This can be
+ * used with the coordinates of a geometry column to partition points by
+ * location.
+ *
+ * @param[in] x
+ * @param[in] y
+ * @param[in] num_points
+ * @param[in] min_x
+ * @param[in] min_y
+ * @param[in] max_x
+ * @param[in] max_y
+ * @param[out] codes An array of num_points codes.
  * @return CASS_OK if successful, otherwise an error occurred.
+ *
+ * @see dse_geometry_column_x()
+ * @see dse_geometry_column_y()
  */
 DSE_EXPORT CassError
-dse_polygon_iterator_next_num_points(DsePolygonIterator* iterator,
-                                     cass_uint32_t* num_points);
+dse_morton_code_n(const cass_double_t* x, const cass_double_t* y,
+                  size_t num_points,
+                  cass_double_t min_x, cass_double_t min_y,
+                  cass_double_t max_x, cass_double_t max_y,
+                  cass_uint64_t* codes);
 
 /**
- * Gets the next point in the current ring.
+ * Computes the Hilbert curve indexes of an array of points using the same
+ * grid as dse_morton_code_n(). Points that are close on the Hilbert curve
+ * are always close in space.
  *
- * @public @memberof DsePolygonIterator
+ * @param[in] x
+ * @param[in] y
+ * @param[in] num_points
+ * @param[in] min_x
+ * @param[in] min_y
+ * @param[in] max_x
+ * @param[in] max_y
+ * @param[out] indices An array of num_points indexes.
+ * @return CASS_OK if successful, otherwise an error occurred.
  *
- * @param[in] iterator
- * @param[out] x
- * @param[out] y
+ * @see dse_morton_code_n()
+ */
+DSE_EXPORT CassError
+dse_hilbert_index_n(const cass_double_t* x, const cass_double_t* y,
+                    size_t num_points,
+                    cass_double_t min_x, cass_double_t min_y,
+                    cass_double_t max_x, cass_double_t max_y,
+                    cass_uint64_t* indices);
+
+/**
+ * Computes the geohashes of an array of points where the x coordinates are
+ * longitudes and the y coordinates are latitudes in degrees.
+ *
+ * @param[in] x
+ * @param[in] y
+ * @param[in] num_points
+ * @param[in] precision The number of characters of each geohash (1 to 12).
+ * @param[out] output A buffer of num_points * precision characters. The
+ * geohashes are not null-terminated.
  * @return CASS_OK if successful, otherwise an error occurred.
  */
 DSE_EXPORT CassError
-dse_polygon_iterator_next_point(DsePolygonIterator* iterator,
-                                cass_double_t* x, cass_double_t* y);
+dse_geohash_n(const cass_double_t* x, const cass_double_t* y,
+              size_t num_points,
+              size_t precision,
+              char* output);
 
 /***********************************************************************************
  *
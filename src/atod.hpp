@@ -0,0 +1,23 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_ATOD_HPP_INCLUDED__
+#define __DSE_ATOD_HPP_INCLUDED__
+
+namespace dse {
+
+// Parses a number of the form "[+-]ddd[.ddd][(e|E)[+-]ddd]" in
+// [first, last) into the nearest double. Unlike atof()/strtod() it doesn't
+// require a null terminated copy of the number and it is independent of the
+// current locale. Most numbers are converted using the Eisel-Lemire algorithm
+// and the rest fall back to exact (but slower) decimal arithmetic. Returns
+// false if the range isn't a valid number.
+bool atod(const char* first, const char* last, double* value);
+
+} // namespace dse
+
+#endif
@@ -0,0 +1,350 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "dtoa.hpp"
+
+#include "dse.h"
+
+#include "wkt.hpp"
+
+#include <string.h>
+
+// This is an implementation of Florian Loitsch's Grisu2 algorithm from
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers".
+// Grisu2 always produces digits that round-trip and produces the shortest
+// digits for more than 99.9% of doubles.
+
+namespace {
+
+const cass_uint64_t kSignificandMask = 0x000FFFFFFFFFFFFFULL;
+const cass_uint64_t kExponentMask = 0x7FF0000000000000ULL;
+const cass_uint64_t kSignMask = 0x8000000000000000ULL;
+const cass_uint64_t kHiddenBit = 0x0010000000000000ULL;
+const int kSignificandSize = 52;
+const int kExponentBias = 0x3FF + kSignificandSize;
+const int kMinExponent = -kExponentBias;
+
+// A "do it yourself" floating point number with a 64-bit significand
+struct DiyFp {
+  DiyFp()
+    : f(0)
+    , e(0) { }
+
+  DiyFp(cass_uint64_t f, int e)
+    : f(f)
+    , e(e) { }
+
+  explicit DiyFp(cass_uint64_t bits) {
+    int biased_e = static_cast<int>((bits & kExponentMask) >> kSignificandSize);
+    cass_uint64_t significand = bits & kSignificandMask;
+    if (biased_e != 0) {
+      f = significand + kHiddenBit;
+      e = biased_e - kExponentBias;
+    } else { // Subnormal
+      f = significand;
+      e = kMinExponent + 1;
+    }
+  }
+
+  DiyFp operator-(const DiyFp& rhs) const {
+    return DiyFp(f - rhs.f, e);
+  }
+
+  // Multiplies two significands and keeps the rounded upper 64 bits
+  DiyFp operator*(const DiyFp& rhs) const {
+    const cass_uint64_t mask = 0xFFFFFFFF;
+    cass_uint64_t a = f >> 32;
+    cass_uint64_t b = f & mask;
+    cass_uint64_t c = rhs.f >> 32;
+    cass_uint64_t d = rhs.f & mask;
+    cass_uint64_t ac = a * c;
+    cass_uint64_t bc = b * c;
+    cass_uint64_t ad = a * d;
+    cass_uint64_t bd = b * d;
+    cass_uint64_t tmp = (bd >> 32) + (ad & mask) + (bc & mask);
+    tmp += 1U << 31; // Round
+    return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64);
+  }
+
+  DiyFp normalize() const {
+    DiyFp result(*this);
+    while (!(result.f & kSignMask)) {
+      result.f <<= 1;
+      result.e--;
+    }
+    return result;
+  }
+
+  // Computes the boundaries m- and m+ halfway to the neighboring doubles
+  // using the same exponent
+  void normalized_boundaries(DiyFp* minus, DiyFp* plus) const {
+    DiyFp p(DiyFp((f << 1) + 1, e - 1).normalize());
+    DiyFp m = (f == kHiddenBit) ? DiyFp((f << 2) - 1, e - 2)  // Lower boundary is closer
+                                : DiyFp((f << 1) - 1, e - 1);
+    m.f <<= m.e - p.e;
+    m.e = p.e;
+    *minus = m;
+    *plus = p;
+  }
+
+  cass_uint64_t f;
+  int e;
+};
+
+// Normalized powers of ten 10^-348, 10^-340, ..., 10^340
+const cass_uint64_t kCachedPowersF[] = {
+  0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+  0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+  0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+  0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+  0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+  0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+  0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+  0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+  0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+  0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+  0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+  0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+  0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+  0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+  0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+  0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+  0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+  0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+  0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+  0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+  0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+  0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+  0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+  0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+  0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+  0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+  0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+  0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+  0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL,
+};
+
+const cass_int16_t kCachedPowersE[] = {
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+  -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+  -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+  -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+  -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+  109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+  375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+  641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+  907, 933, 960, 986, 1013, 1039, 1066,
+};
+
+const cass_uint64_t kPow10[] = {
+  1ULL,
+  10ULL,
+  100ULL,
+  1000ULL,
+  10000ULL,
+  100000ULL,
+  1000000ULL,
+  10000000ULL,
+  100000000ULL,
+  1000000000ULL,
+  10000000000ULL,
+  100000000000ULL,
+  1000000000000ULL,
+  10000000000000ULL,
+  100000000000000ULL,
+  1000000000000000ULL,
+  10000000000000000ULL,
+  100000000000000000ULL,
+  1000000000000000000ULL,
+  10000000000000000000ULL
+};
+
+// Finds a cached power of ten c = 10^-k such that the exponent of w * c is
+// in the range [-60, -32]
+DiyFp cached_power(int e, int* k) {
+  double dk = (-61 - e) * 0.30102999566398114 + 347; // 1 / log2(10)
+  int ik = static_cast<int>(dk);
+  if (dk - ik > 0.0) ik++;
+  unsigned index = static_cast<unsigned>((ik >> 3) + 1);
+  *k = -(-348 + static_cast<int>(index << 3));
+  return DiyFp(kCachedPowersF[index], kCachedPowersE[index]);
+}
+
+int count_decimal_digits(cass_uint32_t n) {
+  int count = 1;
+  while (n >= 10) {
+    n /= 10;
+    count++;
+  }
+  return count;
+}
+
+void grisu_round(char* buffer, int length,
+                 cass_uint64_t delta, cass_uint64_t rest,
+                 cass_uint64_t ten_kappa, cass_uint64_t wp_w) {
+  while (rest < wp_w && delta - rest >= ten_kappa &&
+         (rest + ten_kappa < wp_w || // Closer
+          wp_w - rest > rest + ten_kappa - wp_w)) {
+    buffer[length - 1]--;
+    rest += ten_kappa;
+  }
+}
+
+void digit_gen(const DiyFp& w, const DiyFp& mp, cass_uint64_t delta,
+               char* buffer, int* length, int* k) {
+  const DiyFp one(1ULL << -mp.e, mp.e);
+  const DiyFp wp_w = mp - w;
+  cass_uint32_t p1 = static_cast<cass_uint32_t>(mp.f >> -one.e);
+  cass_uint64_t p2 = mp.f & (one.f - 1);
+  int kappa = count_decimal_digits(p1);
+
+  *length = 0;
+
+  // Integral digits
+  while (kappa > 0) {
+    cass_uint32_t divisor = static_cast<cass_uint32_t>(kPow10[kappa - 1]);
+    cass_uint32_t d = p1 / divisor;
+    p1 %= divisor;
+    if (d || *length) buffer[(*length)++] = static_cast<char>('0' + d);
+    kappa--;
+    cass_uint64_t tmp = (static_cast<cass_uint64_t>(p1) << -one.e) + p2;
+    if (tmp <= delta) {
+      *k += kappa;
+      grisu_round(buffer, *length, delta, tmp, kPow10[kappa] << -one.e, wp_w.f);
+      return;
+    }
+  }
+
+  // Fractional digits
+  for (;;) {
+    p2 *= 10;
+    delta *= 10;
+    char d = static_cast<char>(p2 >> -one.e);
+    if (d || *length) buffer[(*length)++] = static_cast<char>('0' + d);
+    p2 &= one.f - 1;
+    kappa--;
+    if (p2 < delta) {
+      *k += kappa;
+      int index = -kappa;
+      grisu_round(buffer, *length, delta, p2, one.f,
+                  wp_w.f * (index < 20 ? kPow10[index] : 0));
+      return;
+    }
+  }
+}
+
+// Generates the digits of a positive, finite and non-zero value such that
+// value = digits * 10^k
+void grisu2(cass_uint64_t bits, char* buffer, int* length, int* k) {
+  const DiyFp v(bits);
+  DiyFp w_m, w_p;
+  v.normalized_boundaries(&w_m, &w_p);
+
+  const DiyFp c_mk = cached_power(w_p.e, k);
+  const DiyFp w = v.normalize() * c_mk;
+  DiyFp wp = w_p * c_mk;
+  DiyFp wm = w_m * c_mk;
+  wm.f++;
+  wp.f--;
+  digit_gen(w, wp, wp.f - wm.f, buffer, length, k);
+}
+
+char* write_exponent(int exponent, char* buffer) {
+  if (exponent < 0) {
+    *buffer++ = '-';
+    exponent = -exponent;
+  } else {
+    *buffer++ = '+';
+  }
+  if (exponent >= 100) {
+    *buffer++ = static_cast<char>('0' + exponent / 100);
+    exponent %= 100;
+  }
+  *buffer++ = static_cast<char>('0' + exponent / 10);
+  *buffer++ = static_cast<char>('0' + exponent % 10);
+  return buffer;
+}
+
+// Formats the digits using the same rules as "%.<WKT_MAX_DIGITS>g" without
+// trailing zeros
+char* prettify(const char* digits, int length, int k, char* buffer) {
+  const int exponent = length + k - 1; // Exponent of the first digit
+
+  if (exponent < -4 || exponent >= WKT_MAX_DIGITS) {
+    // d[.ddd]e(+|-)dd
+    *buffer++ = digits[0];
+    if (length > 1) {
+      *buffer++ = '.';
+      memcpy(buffer, digits + 1, length - 1);
+      buffer += length - 1;
+    }
+    *buffer++ = 'e';
+    return write_exponent(exponent, buffer);
+  }
+
+  if (exponent < 0) {
+    // 0.000ddd
+    *buffer++ = '0';
+    *buffer++ = '.';
+    for (int i = -1; i > exponent; --i) {
+      *buffer++ = '0';
+    }
+    memcpy(buffer, digits, length);
+    return buffer + length;
+  }
+
+  if (length <= exponent + 1) {
+    // ddd000
+    memcpy(buffer, digits, length);
+    buffer += length;
+    for (int i = length; i <= exponent; ++i) {
+      *buffer++ = '0';
+    }
+    return buffer;
+  }
+
+  // ddd.ddd
+  memcpy(buffer, digits, exponent + 1);
+  buffer += exponent + 1;
+  *buffer++ = '.';
+  memcpy(buffer, digits + exponent + 1, length - exponent - 1);
+  return buffer + length - exponent - 1;
+}
+
+} // namespace
+
+namespace dse {
+
+size_t dtoa(double value, char* buffer) {
+  cass_uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  char* pos = buffer;
+  if (bits & kSignMask) {
+    *pos++ = '-';
+    bits &= ~kSignMask;
+  }
+
+  if ((bits & kExponentMask) == kExponentMask) {
+    const char* special = (bits & kSignificandMask) ? "nan" : "inf";
+    if ((bits & kSignificandMask) && pos != buffer) pos--; // No "-nan"
+    memcpy(pos, special, 3);
+    pos += 3;
+  } else if (bits == 0) {
+    *pos++ = '0';
+  } else {
+    char digits[DTOA_BUFFER_SIZE];
+    int length, k;
+    grisu2(bits, digits, &length, &k);
+    pos = prettify(digits, length, k, pos);
+  }
+
+  *pos = '\0';
+  return pos - buffer;
+}
+
+} // namespace dse
@@ -0,0 +1,27 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_DTOA_HPP_INCLUDED__
+#define __DSE_DTOA_HPP_INCLUDED__
+
+#include <stddef.h>
+
+// Large enough for "-d.ddddddddddddddddde-ddd" and a null terminator
+#define DTOA_BUFFER_SIZE 32
+
+namespace dse {
+
+// Writes the shortest decimal representation of a double that parses back to
+// the same value (using the Grisu2 algorithm) and returns its length. The
+// output is locale independent and formatted like "%.17g" so that existing
+// WKT is unchanged except for the removal of superfluous digits. "buffer" must
+// contain at least DTOA_BUFFER_SIZE characters.
+size_t dtoa(double value, char* buffer);
+
+} // namespace dse
+
+#endif
@@ -0,0 +1,116 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_ENVELOPE_HPP_INCLUDED__
+#define __DSE_ENVELOPE_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+
+#include <limits>
+
+namespace dse {
+
+// The bounding box of a geometry's points. NaN coordinates are ignored.
+class Envelope {
+public:
+  Envelope() {
+    reset();
+  }
+
+  bool is_empty() const { return min_x_ > max_x_; }
+
+  void reset() {
+    min_x_ = min_y_ = std::numeric_limits<cass_double_t>::infinity();
+    max_x_ = max_y_ = -std::numeric_limits<cass_double_t>::infinity();
+  }
+
+  void expand(cass_double_t x, cass_double_t y) {
+    min_x_ = x < min_x_ ? x : min_x_;
+    min_y_ = y < min_y_ ? y : min_y_;
+    max_x_ = x > max_x_ ? x : max_x_;
+    max_y_ = y > max_y_ ? y : max_y_;
+  }
+
+  // Expands using a block of WKB coordinates
+  void expand(const cass_byte_t* points, size_t num_points,
+              WkbByteOrder byte_order) {
+    size_t i = 0;
+#if defined(DSE_USE_SSE2)
+    if (byte_order == native_byte_order() && num_points >= 2) {
+      // Each point is loaded as [x, y] so the minimums and maximums of both
+      // coordinates are reduced at the same time
+      __m128d min = _mm_set_pd(min_y_, min_x_);
+      __m128d max = _mm_set_pd(max_y_, max_x_);
+      __m128d min2 = min, max2 = max;
+      for (; i + 2 <= num_points; i += 2) {
+        __m128d first = _mm_loadu_pd(reinterpret_cast<const double*>(points));
+        __m128d second = _mm_loadu_pd(reinterpret_cast<const double*>(points + 2 * sizeof(cass_double_t)));
+        min = _mm_min_pd(first, min);
+        max = _mm_max_pd(first, max);
+        min2 = _mm_min_pd(second, min2);
+        max2 = _mm_max_pd(second, max2);
+        points += 4 * sizeof(cass_double_t);
+      }
+      min = _mm_min_pd(min, min2);
+      max = _mm_max_pd(max, max2);
+      double temp[2];
+      _mm_storeu_pd(temp, min);
+      min_x_ = temp[0]; min_y_ = temp[1];
+      _mm_storeu_pd(temp, max);
+      max_x_ = temp[0]; max_y_ = temp[1];
+    }
+#endif
+    for (; i < num_points; ++i) {
+      expand(decode_double(points, byte_order),
+             decode_double(points + sizeof(cass_double_t), byte_order));
+      points += 2 * sizeof(cass_double_t);
+    }
+  }
+
+  // Expands using the rings of a WKB polygon where each ring starts with its
+  // number of points. Returns the end of the last ring.
+  const cass_byte_t* expand_rings(const cass_byte_t* rings, cass_uint32_t num_rings,
+                                  WkbByteOrder byte_order) {
+    for (cass_uint32_t i = 0; i < num_rings; ++i) {
+      cass_uint32_t num_points = decode_uint32(rings, byte_order);
+      rings += sizeof(cass_uint32_t);
+      expand(rings, num_points, byte_order);
+      rings += 2 * num_points * sizeof(cass_double_t);
+    }
+    return rings;
+  }
+
+  bool intersects(cass_double_t min_x, cass_double_t min_y,
+                  cass_double_t max_x, cass_double_t max_y) const {
+    return min_x <= max_x_ && max_x >= min_x_ &&
+        min_y <= max_y_ && max_y >= min_y_;
+  }
+
+  CassError get(cass_double_t* min_x, cass_double_t* min_y,
+                cass_double_t* max_x, cass_double_t* max_y) const {
+    if (is_empty()) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+    *min_x = min_x_;
+    *min_y = min_y_;
+    *max_x = max_x_;
+    *max_y = max_y_;
+    return CASS_OK;
+  }
+
+private:
+  cass_double_t min_x_;
+  cass_double_t min_y_;
+  cass_double_t max_x_;
+  cass_double_t max_y_;
+};
+
+} // namespace dse
+
+#endif
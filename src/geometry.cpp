@@ -0,0 +1,227 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "geometry.hpp"
+
+namespace {
+
+bool to_geometry_type(WktLexer::Token token, dse::WkbGeometryType* type) {
+  switch (token) {
+    case WktLexer::TK_TYPE_POINT:
+      *type = dse::WKB_GEOMETRY_TYPE_POINT; return true;
+    case WktLexer::TK_TYPE_LINESTRING:
+      *type = dse::WKB_GEOMETRY_TYPE_LINESTRING; return true;
+    case WktLexer::TK_TYPE_POLYGON:
+      *type = dse::WKB_GEOMETRY_TYPE_POLYGON; return true;
+    case WktLexer::TK_TYPE_MULTIPOINT:
+      *type = dse::WKB_GEOMETRY_TYPE_MULTIPOINT; return true;
+    case WktLexer::TK_TYPE_MULTILINESTRING:
+      *type = dse::WKB_GEOMETRY_TYPE_MULTILINESTRING; return true;
+    case WktLexer::TK_TYPE_MULTIPOLYGON:
+      *type = dse::WKB_GEOMETRY_TYPE_MULTIPOLYGON; return true;
+    case WktLexer::TK_TYPE_GEOMETRYCOLLECTION:
+      *type = dse::WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION; return true;
+    default:
+      return false;
+  }
+}
+
+// Collections are limited to the geometries that have their own iterators
+bool is_collection_element(dse::WkbGeometryType type) {
+  return type == dse::WKB_GEOMETRY_TYPE_POINT ||
+         type == dse::WKB_GEOMETRY_TYPE_LINESTRING ||
+         type == dse::WKB_GEOMETRY_TYPE_POLYGON;
+}
+
+} // namespace
+
+namespace dse {
+
+CassError WktParser::parse(WkbGeometryType type, Bytes& bytes) {
+  WkbGeometryType token_type;
+
+  next_token();
+  if (!to_geometry_type(token_, &token_type) || token_type != type) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  next_token();
+
+  return parse_geometry(type, bytes);
+}
+
+CassError WktParser::parse_geometry(WkbGeometryType type, Bytes& bytes) {
+  encode_header_append(type, bytes);
+
+  switch (type) {
+    case WKB_GEOMETRY_TYPE_POINT: {
+      if (token_ != WktLexer::TK_OPEN_PAREN) {
+        return CASS_ERROR_LIB_BAD_PARAMS;
+      }
+      next_token();
+      CassError rc = parse_coordinates(bytes);
+      if (rc != CASS_OK) return rc;
+      if (token_ != WktLexer::TK_CLOSE_PAREN) {
+        return CASS_ERROR_LIB_BAD_PARAMS;
+      }
+      next_token();
+      return CASS_OK;
+    }
+    case WKB_GEOMETRY_TYPE_LINESTRING:
+      return parse_list(&WktParser::parse_coordinates, bytes);
+    case WKB_GEOMETRY_TYPE_POLYGON:
+      return parse_list(&WktParser::parse_ring, bytes);
+    case WKB_GEOMETRY_TYPE_MULTIPOINT:
+      return parse_list(&WktParser::parse_point, bytes);
+    case WKB_GEOMETRY_TYPE_MULTILINESTRING:
+      return parse_list(&WktParser::parse_line_string, bytes);
+    case WKB_GEOMETRY_TYPE_MULTIPOLYGON:
+      return parse_list(&WktParser::parse_polygon, bytes);
+    case WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION:
+      return parse_list(&WktParser::parse_collection_element, bytes);
+  }
+
+  return CASS_ERROR_LIB_BAD_PARAMS;
+}
+
+// Parses "(element, element, ...)" and encodes the number of elements
+// followed by the elements themselves
+CassError WktParser::parse_list(ParseElement parse_element, Bytes& bytes) {
+  if (token_ != WktLexer::TK_OPEN_PAREN) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  next_token();
+
+  size_t count_index = bytes.size();
+  encode_append(0u, bytes);
+
+  cass_uint32_t count = 0;
+  if (token_ != WktLexer::TK_CLOSE_PAREN) {
+    while (true) {
+      CassError rc = (this->*parse_element)(bytes);
+      if (rc != CASS_OK) return rc;
+      ++count;
+
+      if (token_ != WktLexer::TK_COMMA) break;
+      next_token();
+    }
+
+    if (token_ != WktLexer::TK_CLOSE_PAREN) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+  }
+  next_token();
+
+  encode(count, count_index, bytes);
+  return CASS_OK;
+}
+
+CassError WktParser::parse_coordinates(Bytes& bytes) {
+  if (token_ != WktLexer::TK_NUMBER) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  encode_append(lexer_.number(), bytes);
+  next_token();
+
+  if (token_ != WktLexer::TK_NUMBER) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  encode_append(lexer_.number(), bytes);
+  next_token();
+
+  return CASS_OK;
+}
+
+// Multi point elements can be written either as "(x y)" or "x y"
+CassError WktParser::parse_point(Bytes& bytes) {
+  if (token_ == WktLexer::TK_OPEN_PAREN) {
+    return parse_geometry(WKB_GEOMETRY_TYPE_POINT, bytes);
+  }
+  encode_header_append(WKB_GEOMETRY_TYPE_POINT, bytes);
+  return parse_coordinates(bytes);
+}
+
+CassError WktParser::parse_line_string(Bytes& bytes) {
+  return parse_geometry(WKB_GEOMETRY_TYPE_LINESTRING, bytes);
+}
+
+CassError WktParser::parse_ring(Bytes& bytes) {
+  return parse_list(&WktParser::parse_coordinates, bytes);
+}
+
+CassError WktParser::parse_polygon(Bytes& bytes) {
+  return parse_geometry(WKB_GEOMETRY_TYPE_POLYGON, bytes);
+}
+
+CassError WktParser::parse_collection_element(Bytes& bytes) {
+  WkbGeometryType type;
+  if (!to_geometry_type(token_, &type) || !is_collection_element(type)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  next_token();
+  return parse_geometry(type, bytes);
+}
+
+CassError decode_multi_geometry(const cass_byte_t* data, size_t size,
+                                WkbGeometryType type,
+                                cass_uint32_t* num_geometries,
+                                const cass_byte_t** geometries_end) {
+  WkbByteOrder byte_order;
+
+  if (size < WKB_MULTI_HEADER_SIZE) {
+    return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+  }
+  size -= WKB_MULTI_HEADER_SIZE;
+
+  if (decode_header(data, &byte_order) != type) {
+    return CASS_ERROR_LIB_INVALID_DATA;
+  }
+
+  cass_uint32_t num_elements = decode_uint32(data + WKB_HEADER_SIZE, byte_order);
+  const cass_byte_t* pos = data + WKB_MULTI_HEADER_SIZE;
+
+  for (cass_uint32_t i = 0; i < num_elements; ++i) {
+    WkbByteOrder element_byte_order;
+    size_t element_size;
+
+    if (size < WKB_HEADER_SIZE) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+
+    WkbGeometryType element_type = decode_header(pos, &element_byte_order);
+    bool is_valid_type;
+    switch (type) {
+      case WKB_GEOMETRY_TYPE_MULTIPOINT:
+        is_valid_type = element_type == WKB_GEOMETRY_TYPE_POINT;
+        break;
+      case WKB_GEOMETRY_TYPE_MULTILINESTRING:
+        is_valid_type = element_type == WKB_GEOMETRY_TYPE_LINESTRING;
+        break;
+      case WKB_GEOMETRY_TYPE_MULTIPOLYGON:
+        is_valid_type = element_type == WKB_GEOMETRY_TYPE_POLYGON;
+        break;
+      default:
+        is_valid_type = is_collection_element(element_type);
+        break;
+    }
+    if (!is_valid_type) {
+      return CASS_ERROR_LIB_INVALID_DATA;
+    }
+
+    if (!decode_geometry_size(pos, size, &element_size)) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+    pos += element_size;
+    size -= element_size;
+  }
+
+  *num_geometries = num_elements;
+  *geometries_end = pos;
+
+  return CASS_OK;
+}
+
+} // namespace dse
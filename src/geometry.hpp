@@ -0,0 +1,57 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_GEOMETRY_HPP_INCLUDED__
+#define __DSE_GEOMETRY_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+#include "wkt.hpp"
+
+namespace dse {
+
+// Parses WKT text into native byte order WKB so that geometries from graph
+// results can be iterated using the same code as binary values.
+class WktParser {
+public:
+  WktParser(const char* text, size_t size)
+    : lexer_(text, size)
+    , token_(WktLexer::TK_INVALID) { }
+
+  CassError parse(WkbGeometryType type, Bytes& bytes);
+
+private:
+  typedef CassError (WktParser::*ParseElement)(Bytes& bytes);
+
+  void next_token() { token_ = lexer_.next_token(); }
+
+  CassError parse_geometry(WkbGeometryType type, Bytes& bytes);
+  CassError parse_list(ParseElement parse_element, Bytes& bytes);
+
+  CassError parse_coordinates(Bytes& bytes);
+  CassError parse_point(Bytes& bytes);
+  CassError parse_line_string(Bytes& bytes);
+  CassError parse_ring(Bytes& bytes);
+  CassError parse_polygon(Bytes& bytes);
+  CassError parse_collection_element(Bytes& bytes);
+
+private:
+  WktLexer lexer_;
+  WktLexer::Token token_;
+};
+
+// Validates the elements of a multi geometry or geometry collection and
+// determines where they end.
+CassError decode_multi_geometry(const cass_byte_t* data, size_t size,
+                                WkbGeometryType type,
+                                cass_uint32_t* num_geometries,
+                                const cass_byte_t** geometries_end);
+
+} // namespace dse
+
+#endif
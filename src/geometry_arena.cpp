@@ -0,0 +1,32 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "geometry_arena.hpp"
+
+extern "C" {
+
+DseGeometryArena* dse_geometry_arena_new() {
+  return DseGeometryArena::to(new dse::GeometryArena());
+}
+
+void dse_geometry_arena_free(DseGeometryArena* arena) {
+  delete arena->from();
+}
+
+void dse_geometry_arena_reset(DseGeometryArena* arena) {
+  arena->reset();
+}
+
+DseLineString* dse_geometry_arena_new_line_string(DseGeometryArena* arena) {
+  return DseLineString::to(arena->new_line_string());
+}
+
+DsePolygon* dse_geometry_arena_new_polygon(DseGeometryArena* arena) {
+  return DsePolygon::to(arena->new_polygon());
+}
+
+} // extern "C"
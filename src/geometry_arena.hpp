@@ -0,0 +1,80 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_GEOMETRY_ARENA_HPP_INCLUDED__
+#define __DSE_GEOMETRY_ARENA_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "line_string.hpp"
+#include "polygon.hpp"
+
+#include <external.hpp>
+
+#include <vector>
+
+namespace dse {
+
+// Hands out builders that are kept between batches. Resetting the pool makes
+// every builder available again, but keeps their memory so that building
+// geometries of similar sizes doesn't allocate once the pool is warmed up.
+template <class T>
+class GeometryPool {
+public:
+  GeometryPool()
+    : num_used_(0) { }
+
+  ~GeometryPool() {
+    for (typename std::vector<T*>::iterator i = objects_.begin(),
+         end = objects_.end(); i != end; ++i) {
+      delete *i;
+    }
+  }
+
+  size_t num_used() const { return num_used_; }
+
+  T* acquire() {
+    if (num_used_ == objects_.size()) {
+      objects_.push_back(new T());
+      return objects_[num_used_++];
+    }
+    T* object = objects_[num_used_++];
+    object->reset();
+    return object;
+  }
+
+  void reset() { num_used_ = 0; }
+
+private:
+  GeometryPool(const GeometryPool&);
+  GeometryPool& operator=(const GeometryPool&);
+
+private:
+  std::vector<T*> objects_;
+  size_t num_used_;
+};
+
+class GeometryArena {
+public:
+  LineString* new_line_string() { return line_strings_.acquire(); }
+  Polygon* new_polygon() { return polygons_.acquire(); }
+
+  void reset() {
+    line_strings_.reset();
+    polygons_.reset();
+  }
+
+private:
+  GeometryPool<LineString> line_strings_;
+  GeometryPool<Polygon> polygons_;
+};
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::GeometryArena, DseGeometryArena)
+
+#endif
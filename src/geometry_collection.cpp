@@ -0,0 +1,205 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "geometry_collection.hpp"
+#include "geometry.hpp"
+#include "validate.hpp"
+
+extern "C" {
+
+DseGeometryCollection* dse_geometry_collection_new() {
+  return DseGeometryCollection::to(new dse::GeometryCollection());
+}
+
+void dse_geometry_collection_free(DseGeometryCollection* collection) {
+  delete collection->from();
+}
+
+void dse_geometry_collection_reset(DseGeometryCollection* collection) {
+  collection->reset();
+}
+
+CassError dse_geometry_collection_add_point(DseGeometryCollection* collection,
+                                            cass_double_t x, cass_double_t y) {
+  collection->add_point(x, y);
+  return CASS_OK;
+}
+
+CassError dse_geometry_collection_add_line_string(DseGeometryCollection* collection,
+                                                  const DseLineString* line_string) {
+  return collection->add_line_string(*line_string->from());
+}
+
+CassError dse_geometry_collection_add_polygon(DseGeometryCollection* collection,
+                                              const DsePolygon* polygon) {
+  return collection->add_polygon(*polygon->from());
+}
+
+CassError dse_geometry_collection_finish(DseGeometryCollection* collection) {
+  return collection->finish();
+}
+
+DseGeometryCollectionIterator* dse_geometry_collection_iterator_new() {
+  return DseGeometryCollectionIterator::to(new dse::GeometryCollectionIterator());
+}
+
+void dse_geometry_collection_iterator_free(DseGeometryCollectionIterator* iterator) {
+  delete iterator->from();
+}
+
+CassError dse_geometry_collection_iterator_reset(DseGeometryCollectionIterator* iterator,
+                                                 const CassValue* value) {
+  return iterator->reset_binary(value);
+}
+
+cass_uint32_t dse_geometry_collection_iterator_num_geometries(const DseGeometryCollectionIterator* iterator) {
+  return iterator->num_geometries();
+}
+
+CassError dse_geometry_collection_iterator_next_type(const DseGeometryCollectionIterator* iterator,
+                                                     DseGeometryType* type) {
+  return iterator->next_type(type);
+}
+
+CassError dse_geometry_collection_iterator_next_point(DseGeometryCollectionIterator* iterator,
+                                                      cass_double_t* x, cass_double_t* y) {
+  return iterator->next_point(x, y);
+}
+
+CassError dse_geometry_collection_iterator_next_line_string(DseGeometryCollectionIterator* iterator,
+                                                            DseLineStringIterator* line_string) {
+  return iterator->next_line_string(line_string);
+}
+
+CassError dse_geometry_collection_iterator_next_polygon(DseGeometryCollectionIterator* iterator,
+                                                        DsePolygonIterator* polygon) {
+  return iterator->next_polygon(polygon);
+}
+
+} // extern "C"
+
+namespace dse {
+
+std::string GeometryCollection::to_wkt() const {
+  std::string wkt;
+  WktWriter<std::string> writer(wkt);
+  to_wkt(writer);
+  return wkt;
+}
+
+CassError GeometryCollection::add_geometry(const Bytes& geometry) {
+  size_t size;
+  // Only finished geometries can be added to the collection
+  if (!decode_geometry_size(geometry.data(), geometry.size(), &size) ||
+      size != geometry.size()) {
+    return CASS_ERROR_LIB_INVALID_STATE;
+  }
+  bytes_.insert(bytes_.end(), geometry.begin(), geometry.end());
+  num_geometries_++;
+  return CASS_OK;
+}
+
+CassError GeometryCollectionIterator::reset_binary(const CassValue* value) {
+  size_t size;
+  const cass_byte_t* pos;
+
+  CassError rc = data_type_validator_.validate(value);
+  if (rc != CASS_OK) return rc;
+
+  rc = cass_value_get_bytes(value, &pos, &size);
+  if (rc != CASS_OK) return rc;
+
+  return reset_binary(pos, size);
+}
+
+CassError GeometryCollectionIterator::reset_binary(const cass_byte_t* data, size_t size) {
+  cass_uint32_t num_geometries;
+  const cass_byte_t* end;
+
+  CassError rc = decode_multi_geometry(data, size,
+                                       WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION,
+                                       &num_geometries, &end);
+  if (rc != CASS_OK) return rc;
+
+  num_geometries_ = num_geometries;
+  position_ = data + WKB_MULTI_HEADER_SIZE;
+  end_ = end;
+
+  return CASS_OK;
+}
+
+CassError GeometryCollectionIterator::reset_text(const char* text, size_t size) {
+  num_geometries_ = 0;
+  position_ = end_ = NULL;
+  text_bytes_.clear();
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION, text_bytes_);
+  if (rc != CASS_OK) return rc;
+  return reset_binary(text_bytes_.data(), text_bytes_.size());
+}
+
+CassError GeometryCollectionIterator::next_type(DseGeometryType* type) const {
+  if (position_ >= end_) {
+    return CASS_ERROR_LIB_INVALID_STATE;
+  }
+  WkbByteOrder byte_order;
+  *type = static_cast<DseGeometryType>(decode_header(position_, &byte_order));
+  return CASS_OK;
+}
+
+CassError GeometryCollectionIterator::next_point(cass_double_t* x, cass_double_t* y) {
+  size_t size;
+
+  CassError rc = next_geometry(WKB_GEOMETRY_TYPE_POINT, &size);
+  if (rc != CASS_OK) return rc;
+
+  WkbByteOrder byte_order;
+  decode_header(position_, &byte_order);
+  *x = decode_double(position_ + WKB_HEADER_SIZE, byte_order);
+  *y = decode_double(position_ + WKB_HEADER_SIZE + sizeof(cass_double_t), byte_order);
+  position_ += size;
+
+  return CASS_OK;
+}
+
+CassError GeometryCollectionIterator::next_line_string(LineStringIterator* line_string) {
+  size_t size;
+
+  CassError rc = next_geometry(WKB_GEOMETRY_TYPE_LINESTRING, &size);
+  if (rc != CASS_OK) return rc;
+
+  rc = line_string->reset_binary(position_, size);
+  position_ += size;
+
+  return rc;
+}
+
+CassError GeometryCollectionIterator::next_polygon(PolygonIterator* polygon) {
+  size_t size;
+
+  CassError rc = next_geometry(WKB_GEOMETRY_TYPE_POLYGON, &size);
+  if (rc != CASS_OK) return rc;
+
+  // Already validated by decode_geometry_size()
+  rc = polygon->reset_binary_unchecked(position_, size);
+  position_ += size;
+
+  return rc;
+}
+
+CassError GeometryCollectionIterator::next_geometry(WkbGeometryType type, size_t* size) {
+  WkbByteOrder byte_order;
+
+  if (position_ >= end_ ||
+      decode_header(position_, &byte_order) != type ||
+      !decode_geometry_size(position_, end_ - position_, size)) {
+    return CASS_ERROR_LIB_INVALID_STATE;
+  }
+
+  return CASS_OK;
+}
+
+} // namespace dse
@@ -0,0 +1,112 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_GEOMETRY_COLLECTION_HPP_INCLUDED__
+#define __DSE_GEOMETRY_COLLECTION_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "line_string.hpp"
+#include "polygon.hpp"
+#include "serialization.hpp"
+#include "validate.hpp"
+#include "wkt_writer.hpp"
+
+#include <external.hpp>
+
+#include <string>
+
+namespace dse {
+
+class GeometryCollection {
+public:
+  GeometryCollection() {
+    reset();
+  }
+
+  const Bytes& bytes() const { return bytes_; }
+
+  void reset() {
+    num_geometries_ = 0;
+    bytes_.clear();
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE + // Header and num geometries
+                   2 * WKB_POINT_SIZE);    // Two points
+    encode_header_append(WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION, bytes_);
+    encode_append(0u, bytes_);
+  }
+
+  void add_point(cass_double_t x, cass_double_t y) {
+    encode_header_append(WKB_GEOMETRY_TYPE_POINT, bytes_);
+    encode_append(x, bytes_);
+    encode_append(y, bytes_);
+    num_geometries_++;
+  }
+
+  CassError add_line_string(const LineString& line_string) {
+    return add_geometry(line_string.bytes());
+  }
+
+  CassError add_polygon(const Polygon& polygon) {
+    return add_geometry(polygon.bytes());
+  }
+
+  CassError finish() {
+    encode(num_geometries_, WKB_HEADER_SIZE, bytes_);
+    return CASS_OK;
+  }
+
+  std::string to_wkt() const;
+
+  template <class Buffer>
+  void to_wkt(WktWriter<Buffer>& writer) const {
+    writer.write_geometry(bytes_.data(), true);
+  }
+
+private:
+  CassError add_geometry(const Bytes& geometry);
+
+private:
+  cass_uint32_t num_geometries_;
+  Bytes bytes_;
+};
+
+class GeometryCollectionIterator {
+public:
+  GeometryCollectionIterator()
+    : data_type_validator_(DSE_GEOMETRY_COLLECTION_TYPE)
+    , num_geometries_(0)
+    , position_(NULL)
+    , end_(NULL) { }
+
+  cass_uint32_t num_geometries() const { return num_geometries_; }
+
+  CassError reset_binary(const CassValue* value);
+  CassError reset_binary(const cass_byte_t* data, size_t size);
+  CassError reset_text(const char* text, size_t size);
+
+  CassError next_type(DseGeometryType* type) const;
+  CassError next_point(cass_double_t* x, cass_double_t* y);
+  CassError next_line_string(LineStringIterator* line_string);
+  CassError next_polygon(PolygonIterator* polygon);
+
+private:
+  CassError next_geometry(WkbGeometryType type, size_t* size);
+
+private:
+  DataTypeValidator data_type_validator_;
+  cass_uint32_t num_geometries_;
+  const cass_byte_t* position_;
+  const cass_byte_t* end_;
+  Bytes text_bytes_;
+};
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::GeometryCollection, DseGeometryCollection)
+EXTERNAL_TYPE(dse::GeometryCollectionIterator, DseGeometryCollectionIterator)
+
+#endif
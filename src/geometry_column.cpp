@@ -0,0 +1,150 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "geometry_column.hpp"
+
+#include "string_ref.hpp"
+
+extern "C" {
+
+DseGeometryColumn* dse_geometry_column_new() {
+  return DseGeometryColumn::to(new dse::GeometryColumn());
+}
+
+void dse_geometry_column_free(DseGeometryColumn* column) {
+  delete column->from();
+}
+
+CassError dse_geometry_column_reset(DseGeometryColumn* column,
+                                    const CassResult* result,
+                                    size_t index) {
+  return column->reset(result, index);
+}
+
+size_t dse_geometry_column_num_rows(const DseGeometryColumn* column) {
+  return column->num_rows();
+}
+
+size_t dse_geometry_column_num_points(const DseGeometryColumn* column) {
+  return column->num_points();
+}
+
+const cass_double_t* dse_geometry_column_x(const DseGeometryColumn* column) {
+  return column->x();
+}
+
+const cass_double_t* dse_geometry_column_y(const DseGeometryColumn* column) {
+  return column->y();
+}
+
+const size_t* dse_geometry_column_offsets(const DseGeometryColumn* column) {
+  return column->offsets();
+}
+
+} // extern "C"
+
+namespace dse {
+
+CassError GeometryColumn::reset(const CassResult* result, size_t index) {
+  clear(WKB_GEOMETRY_TYPE_POINT);
+
+  if (index >= cass_result_column_count(result)) {
+    return CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS;
+  }
+
+  // The type is the same for every row so it's only checked once
+  const CassDataType* data_type = cass_result_column_data_type(result, index);
+  if (data_type == NULL) {
+    return CASS_ERROR_LIB_INTERNAL_ERROR;
+  }
+
+  if (cass_data_type_type(data_type) != CASS_VALUE_TYPE_CUSTOM) {
+    return CASS_ERROR_LIB_INVALID_VALUE_TYPE;
+  }
+
+  const char* name;
+  size_t name_length;
+  cass_data_type_class_name(data_type, &name, &name_length);
+
+  cass::StringRef class_name(name, name_length);
+  WkbGeometryType type;
+  if (class_name == DSE_POINT_TYPE) {
+    type = WKB_GEOMETRY_TYPE_POINT;
+  } else if (class_name == DSE_LINE_STRING_TYPE) {
+    type = WKB_GEOMETRY_TYPE_LINESTRING;
+  } else {
+    return CASS_ERROR_LIB_INVALID_CUSTOM_TYPE;
+  }
+
+  clear(type);
+
+  size_t num_rows = cass_result_row_count(result);
+  reserve(num_rows, type == WKB_GEOMETRY_TYPE_POINT ? num_rows : 0);
+
+  CassIterator* rows = cass_iterator_from_result(result);
+  CassError rc = CASS_OK;
+  while (rc == CASS_OK && cass_iterator_next(rows)) {
+    rc = append(cass_row_get_column(cass_iterator_get_row(rows), index));
+  }
+  cass_iterator_free(rows);
+
+  if (rc != CASS_OK) {
+    clear(type);
+  }
+
+  return rc;
+}
+
+CassError GeometryColumn::append(const CassValue* value) {
+  if (value == NULL || cass_value_is_null(value)) {
+    offsets_.push_back(x_.size());
+    return CASS_OK;
+  }
+
+  const cass_byte_t* pos;
+  size_t size;
+
+  CassError rc = cass_value_get_bytes(value, &pos, &size);
+  if (rc != CASS_OK) return rc;
+
+  if (size < WKB_HEADER_SIZE) {
+    return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+  }
+
+  WkbByteOrder byte_order;
+  if (decode_header(pos, &byte_order) != type_) {
+    return CASS_ERROR_LIB_INVALID_DATA;
+  }
+  pos += WKB_HEADER_SIZE;
+  size -= WKB_HEADER_SIZE;
+
+  cass_uint32_t num_points = 1;
+  if (type_ == WKB_GEOMETRY_TYPE_LINESTRING) {
+    if (size < sizeof(cass_uint32_t)) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+    num_points = decode_uint32(pos, byte_order);
+    pos += sizeof(cass_uint32_t);
+    size -= sizeof(cass_uint32_t);
+  }
+
+  if (size / (2 * sizeof(cass_double_t)) < num_points) {
+    return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+  }
+
+  if (num_points > 0) {
+    size_t start = x_.size();
+    x_.resize(start + num_points);
+    y_.resize(start + num_points);
+    decode_points_xy(pos, num_points, byte_order, &x_[start], &y_[start]);
+  }
+  offsets_.push_back(x_.size());
+
+  return CASS_OK;
+}
+
+} // namespace dse
@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_GEOMETRY_COLUMN_HPP_INCLUDED__
+#define __DSE_GEOMETRY_COLUMN_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+
+#include <external.hpp>
+
+#include <vector>
+
+namespace dse {
+
+// Decodes the points of every row of a point or line string column into
+// separate arrays of x and y coordinates. The points of row i are in the
+// range [offsets[i], offsets[i + 1]).
+class GeometryColumn {
+public:
+  GeometryColumn() {
+    clear(WKB_GEOMETRY_TYPE_POINT);
+  }
+
+  size_t num_rows() const { return offsets_.size() - 1; }
+  size_t num_points() const { return x_.size(); }
+
+  const cass_double_t* x() const { return x_.empty() ? NULL : &x_[0]; }
+  const cass_double_t* y() const { return y_.empty() ? NULL : &y_[0]; }
+  const size_t* offsets() const { return &offsets_[0]; }
+
+  CassError reset(const CassResult* result, size_t index);
+
+  void clear(WkbGeometryType type) {
+    type_ = type;
+    x_.clear();
+    y_.clear();
+    offsets_.clear();
+    offsets_.push_back(0);
+  }
+
+  void reserve(size_t num_rows, size_t num_points) {
+    x_.reserve(num_points);
+    y_.reserve(num_points);
+    offsets_.reserve(num_rows + 1);
+  }
+
+  // Null values are added as rows without any points
+  CassError append(const CassValue* value);
+
+private:
+  WkbGeometryType type_;
+  std::vector<cass_double_t> x_;
+  std::vector<cass_double_t> y_;
+  std::vector<size_t> offsets_;
+};
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::GeometryColumn, DseGeometryColumn)
+
+#endif
@@ -8,6 +8,10 @@
 #include "graph.hpp"
 
 #include "wkt.hpp"
+#include "wkt_writer.hpp"
+
+#include "rapidjson/internal/dtoa.h"
+#include "rapidjson/internal/itoa.h"
 
 #include <map_iterator.hpp>
 #include <request_handler.hpp>
@@ -19,8 +23,6 @@
 #include <logger.hpp>
 
 #include <assert.h>
-#include <iomanip>
-#include <sstream>
 
 using cass::Logger;
 
@@ -38,6 +40,25 @@ static const DseGraphResult* find_member(const DseGraphResult* result,
   return i != result->MemberEnd() ? DseGraphResult::to(&i->value) : NULL;
 }
 
+// Longest integer written by i64toa() e.g. "-9223372036854775808"
+const size_t kMaxInt64Size = 20;
+
+// Same buffer size as rapidjson's Writer::WriteDouble()
+const size_t kMaxDoubleSize = 25;
+
+static CassError add_key_by_index(DseGraphObject* object,
+                                  const DseGraphObjectTemplate* object_template,
+                                  size_t index) {
+  if (index >= object_template->name_count()) {
+    return CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS;
+  }
+  if (!object->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  object->add_key(object_template, index);
+  return CASS_OK;
+}
+
 struct GraphAnalyticsRequest {
   GraphAnalyticsRequest(cass::Session* session,
                         cass::ResponseFuture* future,
@@ -229,7 +250,7 @@ void dse_graph_statement_free(DseGraphStatement* statement) {
 
 CassError dse_graph_statement_bind_values(DseGraphStatement* statement,
                                           const DseGraphObject* values) {
-  if (values != NULL && !values->is_complete()) {
+  if (values != NULL && (!values->is_complete() || values->is_nested())) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   return statement->bind_values(values);
@@ -245,6 +266,8 @@ DseGraphObject* dse_graph_object_new() {
 }
 
 void dse_graph_object_free(DseGraphObject* object) {
+  // Nested objects are freed by their parent
+  if (object->is_nested()) return;
   delete object->from();
 }
 
@@ -265,7 +288,7 @@ CassError dse_graph_object_add_null(DseGraphObject* object,
 CassError dse_graph_object_add_null_n(DseGraphObject* object,
                                       const char* name,
                                       size_t name_length) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -285,7 +308,7 @@ CassError dse_graph_object_add_bool_n(DseGraphObject* object,
                                       const char* name,
                                       size_t name_length,
                                       cass_bool_t value) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -305,7 +328,7 @@ CassError dse_graph_object_add_int32_n(DseGraphObject* object,
                                        const char* name,
                                        size_t name_length,
                                        cass_int32_t value) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -325,7 +348,7 @@ CassError dse_graph_object_add_int64_n(DseGraphObject* object,
                                        const char* name,
                                        size_t name_length,
                                        cass_int64_t value) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -345,7 +368,7 @@ CassError dse_graph_object_add_double_n(DseGraphObject* object,
                                         const char* name,
                                         size_t name_length,
                                         cass_double_t value) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -364,7 +387,7 @@ CassError dse_graph_object_add_string(DseGraphObject* object,
 CassError dse_graph_object_add_string_n(DseGraphObject* object,
                                         const char* name, size_t name_length,
                                         const char* value, size_t value_length) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -384,7 +407,7 @@ CassError dse_graph_object_add_object_n(DseGraphObject* object,
                                         const char* name,
                                         size_t name_length,
                                         const DseGraphObject* value) {
-  if (object->is_complete() || !value->is_complete()) {
+  if (!object->is_writable() || !value->is_complete() || value->is_nested()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -404,7 +427,7 @@ CassError dse_graph_object_add_array_n(DseGraphObject* object,
                                        const char* name,
                                        size_t name_length,
                                        const DseGraphArray* value) {
-  if (object->is_complete() || !value->is_complete()) {
+  if (!object->is_writable() || !value->is_complete() || value->is_nested()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -412,6 +435,38 @@ CassError dse_graph_object_add_array_n(DseGraphObject* object,
   return CASS_OK;
 }
 
+DseGraphObject* dse_graph_object_start_object(DseGraphObject* object,
+                                             const char* name) {
+  return dse_graph_object_start_object_n(object,
+                                         name, strlen(name));
+}
+
+DseGraphObject* dse_graph_object_start_object_n(DseGraphObject* object,
+                                               const char* name,
+                                               size_t name_length) {
+  if (!object->is_writable()) {
+    return NULL;
+  }
+  object->add_key(name, name_length);
+  return DseGraphObject::to(object->start_nested_object());
+}
+
+DseGraphArray* dse_graph_object_start_array(DseGraphObject* object,
+                                            const char* name) {
+  return dse_graph_object_start_array_n(object,
+                                        name, strlen(name));
+}
+
+DseGraphArray* dse_graph_object_start_array_n(DseGraphObject* object,
+                                              const char* name,
+                                              size_t name_length) {
+  if (!object->is_writable()) {
+    return NULL;
+  }
+  object->add_key(name, name_length);
+  return DseGraphArray::to(object->start_nested_array());
+}
+
 CassError dse_graph_object_add_point(DseGraphObject* object,
                                      const char* name,
                                      cass_double_t x, cass_double_t y) {
@@ -424,7 +479,7 @@ CassError dse_graph_object_add_point_n(DseGraphObject* object,
                                        const char* name,
                                        size_t name_length,
                                        cass_double_t x, cass_double_t y) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -444,7 +499,7 @@ CassError dse_graph_object_add_line_string_n(DseGraphObject* object,
                                              const char* name,
                                              size_t name_length,
                                              const DseLineString* value) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -464,7 +519,7 @@ CassError dse_graph_object_add_polygon_n(DseGraphObject* object,
                                          const char* name,
                                          size_t name_length,
                                          const DsePolygon* value) {
-  if (object->is_complete()) {
+  if (!object->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   object->add_key(name, name_length);
@@ -472,11 +527,214 @@ CassError dse_graph_object_add_polygon_n(DseGraphObject* object,
   return CASS_OK;
 }
 
+CassError dse_graph_object_add_multi_point(DseGraphObject* object,
+                                           const char* name,
+                                           const DseMultiPoint* value) {
+  return dse_graph_object_add_multi_point_n(object,
+                                            name, strlen(name),
+                                            value);
+}
+
+CassError dse_graph_object_add_multi_point_n(DseGraphObject* object,
+                                             const char* name,
+                                             size_t name_length,
+                                             const DseMultiPoint* value) {
+  if (!object->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  object->add_key(name, name_length);
+  object->add_multi_point(value->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_multi_line_string(DseGraphObject* object,
+                                                 const char* name,
+                                                 const DseMultiLineString* value) {
+  return dse_graph_object_add_multi_line_string_n(object,
+                                                  name, strlen(name),
+                                                  value);
+}
+
+CassError dse_graph_object_add_multi_line_string_n(DseGraphObject* object,
+                                                   const char* name,
+                                                   size_t name_length,
+                                                   const DseMultiLineString* value) {
+  if (!object->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  object->add_key(name, name_length);
+  object->add_multi_line_string(value->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_multi_polygon(DseGraphObject* object,
+                                             const char* name,
+                                             const DseMultiPolygon* value) {
+  return dse_graph_object_add_multi_polygon_n(object,
+                                              name, strlen(name),
+                                              value);
+}
+
+CassError dse_graph_object_add_multi_polygon_n(DseGraphObject* object,
+                                               const char* name,
+                                               size_t name_length,
+                                               const DseMultiPolygon* value) {
+  if (!object->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  object->add_key(name, name_length);
+  object->add_multi_polygon(value->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_geometry_collection(DseGraphObject* object,
+                                                   const char* name,
+                                                   const DseGeometryCollection* value) {
+  return dse_graph_object_add_geometry_collection_n(object,
+                                                    name, strlen(name),
+                                                    value);
+}
+
+CassError dse_graph_object_add_geometry_collection_n(DseGraphObject* object,
+                                                     const char* name,
+                                                     size_t name_length,
+                                                     const DseGeometryCollection* value) {
+  if (!object->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  object->add_key(name, name_length);
+  object->add_geometry_collection(value->from());
+  return CASS_OK;
+}
+
+DseGraphObjectTemplate* dse_graph_object_template_new() {
+  return DseGraphObjectTemplate::to(new dse::GraphObjectTemplate());
+}
+
+void dse_graph_object_template_free(DseGraphObjectTemplate* object_template) {
+  delete object_template->from();
+}
+
+CassError dse_graph_object_template_add_name(DseGraphObjectTemplate* object_template,
+                                             const char* name) {
+  return dse_graph_object_template_add_name_n(object_template,
+                                              name, strlen(name));
+}
+
+CassError dse_graph_object_template_add_name_n(DseGraphObjectTemplate* object_template,
+                                               const char* name,
+                                               size_t name_length) {
+  object_template->add_name(name, name_length);
+  return CASS_OK;
+}
+
+size_t dse_graph_object_template_name_count(const DseGraphObjectTemplate* object_template) {
+  return object_template->name_count();
+}
+
+CassError dse_graph_object_add_null_by_index(DseGraphObject* object,
+                                             const DseGraphObjectTemplate* object_template,
+                                             size_t index) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_null();
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_bool_by_index(DseGraphObject* object,
+                                             const DseGraphObjectTemplate* object_template,
+                                             size_t index,
+                                             cass_bool_t value) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_bool(value);
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_int32_by_index(DseGraphObject* object,
+                                              const DseGraphObjectTemplate* object_template,
+                                              size_t index,
+                                              cass_int32_t value) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_int32(value);
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_int64_by_index(DseGraphObject* object,
+                                              const DseGraphObjectTemplate* object_template,
+                                              size_t index,
+                                              cass_int64_t value) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_int64(value);
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_double_by_index(DseGraphObject* object,
+                                               const DseGraphObjectTemplate* object_template,
+                                               size_t index,
+                                               cass_double_t value) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_double(value);
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_string_by_index(DseGraphObject* object,
+                                               const DseGraphObjectTemplate* object_template,
+                                               size_t index,
+                                               const char* value) {
+  return dse_graph_object_add_string_by_index_n(object, object_template, index,
+                                                value, strlen(value));
+}
+
+CassError dse_graph_object_add_string_by_index_n(DseGraphObject* object,
+                                                 const DseGraphObjectTemplate* object_template,
+                                                 size_t index,
+                                                 const char* value,
+                                                 size_t value_length) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_string(value, value_length);
+  return CASS_OK;
+}
+
+CassError dse_graph_object_add_point_by_index(DseGraphObject* object,
+                                              const DseGraphObjectTemplate* object_template,
+                                              size_t index,
+                                              cass_double_t x, cass_double_t y) {
+  CassError rc = add_key_by_index(object, object_template, index);
+  if (rc != CASS_OK) return rc;
+  object->add_point(x, y);
+  return CASS_OK;
+}
+
+DseGraphObject* dse_graph_object_start_object_by_index(DseGraphObject* object,
+                                                       const DseGraphObjectTemplate* object_template,
+                                                       size_t index) {
+  if (add_key_by_index(object, object_template, index) != CASS_OK) {
+    return NULL;
+  }
+  return DseGraphObject::to(object->start_nested_object());
+}
+
+DseGraphArray* dse_graph_object_start_array_by_index(DseGraphObject* object,
+                                                     const DseGraphObjectTemplate* object_template,
+                                                     size_t index) {
+  if (add_key_by_index(object, object_template, index) != CASS_OK) {
+    return NULL;
+  }
+  return DseGraphArray::to(object->start_nested_array());
+}
+
 DseGraphArray* dse_graph_array_new() {
   return DseGraphArray::to(new DseGraphArray());
 }
 
 void dse_graph_array_free(DseGraphArray* array) {
+  // Nested arrays are freed by their parent
+  if (array->is_nested()) return;
   delete array->from();
 }
 
@@ -489,7 +747,7 @@ void dse_graph_array_finish(DseGraphArray* array) {
 }
 
 CassError dse_graph_array_add_null(DseGraphArray* array) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_null();
@@ -498,7 +756,7 @@ CassError dse_graph_array_add_null(DseGraphArray* array) {
 
 CassError dse_graph_array_add_bool(DseGraphArray* array,
                                    cass_bool_t value) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_bool(value);
@@ -507,7 +765,7 @@ CassError dse_graph_array_add_bool(DseGraphArray* array,
 
 CassError dse_graph_array_add_int32(DseGraphArray* array,
                                     cass_int32_t value) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_int32(value);
@@ -516,7 +774,7 @@ CassError dse_graph_array_add_int32(DseGraphArray* array,
 
 CassError dse_graph_array_add_int64(DseGraphArray* array,
                                     cass_int64_t value) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_int64(value);
@@ -525,13 +783,39 @@ CassError dse_graph_array_add_int64(DseGraphArray* array,
 
 CassError dse_graph_array_add_double(DseGraphArray* array,
                                      cass_double_t value) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_double(value);
   return CASS_OK;
 }
 
+CassError dse_graph_array_add_int64_n(DseGraphArray* array,
+                                     const cass_int64_t* values,
+                                     size_t count) {
+  if (!array->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  array->add_int64s(values, count);
+  return CASS_OK;
+}
+
+CassError dse_graph_array_add_double_n(DseGraphArray* array,
+                                      const cass_double_t* values,
+                                      size_t count) {
+  if (!array->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  // NaN and infinity can't be represented in JSON
+  for (size_t i = 0; i < count; ++i) {
+    if (values[i] - values[i] != 0.0) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+  }
+  array->add_doubles(values, count);
+  return CASS_OK;
+}
+
 CassError dse_graph_array_add_string(DseGraphArray* array,
                                      const char* value) {
   return dse_graph_array_add_string_n(array, value, strlen(value));
@@ -540,7 +824,7 @@ CassError dse_graph_array_add_string(DseGraphArray* array,
 CassError dse_graph_array_add_string_n(DseGraphArray* array,
                                        const char* value,
                                        size_t value_length) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_string(value, value_length);
@@ -549,7 +833,7 @@ CassError dse_graph_array_add_string_n(DseGraphArray* array,
 
 CassError dse_graph_array_add_object(DseGraphArray* array,
                                      const DseGraphObject* value) {
-  if (array->is_complete() || !value->is_complete()) {
+  if (!array->is_writable() || !value->is_complete() || value->is_nested()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_writer(value, rapidjson::kObjectType);
@@ -558,16 +842,30 @@ CassError dse_graph_array_add_object(DseGraphArray* array,
 
 CassError dse_graph_array_add_array(DseGraphArray* array,
                                     const DseGraphArray* value) {
-  if (array->is_complete() || !value->is_complete()) {
+  if (!array->is_writable() || !value->is_complete() || value->is_nested()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_writer(value, rapidjson::kArrayType);
   return CASS_OK;
 }
 
+DseGraphObject* dse_graph_array_start_object(DseGraphArray* array) {
+  if (!array->is_writable()) {
+    return NULL;
+  }
+  return DseGraphObject::to(array->start_nested_object());
+}
+
+DseGraphArray* dse_graph_array_start_array(DseGraphArray* array) {
+  if (!array->is_writable()) {
+    return NULL;
+  }
+  return DseGraphArray::to(array->start_nested_array());
+}
+
 CassError dse_graph_array_add_point(DseGraphArray* array,
                                     cass_double_t x, cass_double_t y) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_point(x, y);
@@ -576,7 +874,7 @@ CassError dse_graph_array_add_point(DseGraphArray* array,
 
 CassError dse_graph_array_add_line_string(DseGraphArray* array,
                                           const DseLineString* value) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_line_string(value->from());
@@ -585,13 +883,49 @@ CassError dse_graph_array_add_line_string(DseGraphArray* array,
 
 CassError dse_graph_array_add_polygon(DseGraphArray* array,
                                       const DsePolygon* value) {
-  if (array->is_complete()) {
+  if (!array->is_writable()) {
     return CASS_ERROR_LIB_BAD_PARAMS;
   }
   array->add_polygon(value->from());
   return CASS_OK;
 }
 
+CassError dse_graph_array_add_multi_point(DseGraphArray* array,
+                                          const DseMultiPoint* value) {
+  if (!array->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  array->add_multi_point(value->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_array_add_multi_line_string(DseGraphArray* array,
+                                                const DseMultiLineString* value) {
+  if (!array->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  array->add_multi_line_string(value->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_array_add_multi_polygon(DseGraphArray* array,
+                                            const DseMultiPolygon* value) {
+  if (!array->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  array->add_multi_polygon(value->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_array_add_geometry_collection(DseGraphArray* array,
+                                                  const DseGeometryCollection* value) {
+  if (!array->is_writable()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  array->add_geometry_collection(value->from());
+  return CASS_OK;
+}
+
 void dse_graph_resultset_free(DseGraphResultSet* resultset) {
   delete resultset->from();
 }
@@ -804,6 +1138,38 @@ CassError dse_graph_result_as_polygon(const DseGraphResult* result,
   return polygon->reset_text(result->GetString(), result->GetStringLength());
 }
 
+CassError dse_graph_result_as_multi_point(const DseGraphResult* result,
+                                          DseMultiPointIterator* multi_point) {
+  if (!result->IsString()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  return multi_point->reset_text(result->GetString(), result->GetStringLength());
+}
+
+CassError dse_graph_result_as_multi_line_string(const DseGraphResult* result,
+                                                DseMultiLineStringIterator* multi_line_string) {
+  if (!result->IsString()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  return multi_line_string->reset_text(result->GetString(), result->GetStringLength());
+}
+
+CassError dse_graph_result_as_multi_polygon(const DseGraphResult* result,
+                                            DseMultiPolygonIterator* multi_polygon) {
+  if (!result->IsString()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  return multi_polygon->reset_text(result->GetString(), result->GetStringLength());
+}
+
+CassError dse_graph_result_as_geometry_collection(const DseGraphResult* result,
+                                                  DseGeometryCollectionIterator* geometry_collection) {
+  if (!result->IsString()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  return geometry_collection->reset_text(result->GetString(), result->GetStringLength());
+}
+
 } // extern "C"
 
 namespace dse {
@@ -850,11 +1216,87 @@ const GraphResult* GraphResultSet::next() {
   return NULL;
 }
 
+void GraphObjectTemplate::add_name(const char* name, size_t length) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  writer.String(name, static_cast<rapidjson::SizeType>(length));
+  encoded_.append(buffer.GetString(), buffer.GetSize());
+  offsets_.push_back(encoded_.size());
+}
+
+GraphWriter::~GraphWriter() { }
+
+GraphObject* GraphWriter::start_nested_object() {
+  if (!nested_object_) {
+    nested_object_.reset(new GraphObject(GraphObject::Nested()));
+  }
+  GraphWriter* nested = nested_object_.get();
+  Prefix(rapidjson::kObjectType);
+  nested->attach(this);
+  nested->start_object();
+  nested_ = nested;
+  return nested_object_.get();
+}
+
+GraphArray* GraphWriter::start_nested_array() {
+  if (!nested_array_) {
+    nested_array_.reset(new GraphArray(GraphArray::Nested()));
+  }
+  GraphWriter* nested = nested_array_.get();
+  Prefix(rapidjson::kArrayType);
+  nested->attach(this);
+  nested->start_array();
+  nested_ = nested;
+  return nested_array_.get();
+}
+
+void GraphWriter::finish_nested() {
+  if (nested_ == NULL || nested_->is_complete()) return;
+  if (nested_ == nested_object_.get()) {
+    nested_object_->finish();
+  } else {
+    nested_array_->finish();
+  }
+}
+
+void GraphWriter::add_int64s(const cass_int64_t* values, size_t count) {
+  if (count == 0) return;
+  size_t max_size = count * (kMaxInt64Size + 1); // Separators
+  // The first value's prefix adds a separator after any earlier elements
+  // and the rest are always preceded by a separator
+  Prefix(rapidjson::kNumberType);
+  char* begin = os_->Push(max_size);
+  char* pos = rapidjson::internal::i64toa(values[0], begin);
+  for (size_t i = 1; i < count; ++i) {
+    *pos++ = ',';
+    pos = rapidjson::internal::i64toa(values[i], pos);
+  }
+  os_->Pop(max_size - (pos - begin));
+}
+
+void GraphWriter::add_doubles(const cass_double_t* values, size_t count) {
+  if (count == 0) return;
+  size_t max_size = count * (kMaxDoubleSize + 1); // Separators
+  Prefix(rapidjson::kNumberType);
+  char* begin = os_->Push(max_size);
+  // Formatted by rapidjson so they're the same as values added one at a time
+  char* pos = rapidjson::internal::dtoa(values[0], begin);
+  for (size_t i = 1; i < count; ++i) {
+    *pos++ = ',';
+    pos = rapidjson::internal::dtoa(values[i], pos);
+  }
+  os_->Pop(max_size - (pos - begin));
+}
+
 void GraphWriter::add_point(cass_double_t x, cass_double_t y) {
-  std::stringstream ss;
-  ss.precision(WKT_MAX_DIGITS);
-  ss << "POINT (" << x << " " << y << ")";
-  String(ss.str().c_str());
+  size_t max_size = WKT_MAX_POINT_SIZE + 2; // Quotes
+  Prefix(rapidjson::kStringType);
+  WktFixedBuffer wkt(os_->Push(max_size));
+  wkt.append("\"", 1);
+  WktWriter<WktFixedBuffer> writer(wkt);
+  writer.write_point(x, y);
+  wkt.append("\"", 1);
+  os_->Pop(max_size - wkt.size());
 }
 
 } // namespace dse
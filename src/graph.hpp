@@ -12,6 +12,10 @@
 
 #include "line_string.hpp"
 #include "polygon.hpp"
+#include "multi_point.hpp"
+#include "multi_line_string.hpp"
+#include "multi_polygon.hpp"
+#include "geometry_collection.hpp"
 
 #include "rapidjson/document.h"
 #include "rapidjson/writer.h"
@@ -102,22 +106,67 @@ private:
 };
 
 
+// Stores member names escaped and quoted so that they can be copied directly
+// into many objects
+class GraphObjectTemplate {
+public:
+  GraphObjectTemplate()
+    : offsets_(1, 0) { }
+
+  void add_name(const char* name, size_t length);
+
+  size_t name_count() const { return offsets_.size() - 1; }
+
+  const char* encoded_name(size_t index) const {
+    return encoded_.data() + offsets_[index];
+  }
+
+  size_t encoded_name_length(size_t index) const {
+    return offsets_[index + 1] - offsets_[index];
+  }
+
+private:
+  std::string encoded_;
+  std::vector<size_t> offsets_;
+};
+
+class GraphObject;
+class GraphArray;
+
 class GraphWriter : private rapidjson::Writer<rapidjson::StringBuffer> {
 public:
   GraphWriter()
-    : rapidjson::Writer<rapidjson::StringBuffer>(buffer_) { }
+    : rapidjson::Writer<rapidjson::StringBuffer>(buffer_)
+    , nested_(NULL)
+    , is_nested_(false) { }
+
+  ~GraphWriter();
 
   const char* data() const { return buffer_.GetString(); }
   size_t length() const { return buffer_.GetSize(); }
 
   bool is_complete() const { return IsComplete(); }
 
+  // Nested writers are owned by their parent and write into its buffer so
+  // they can't be freed, added to another writer or bound on their own
+  bool is_nested() const { return is_nested_; }
+
+  // Values can't be added while a nested object or array is open
+  bool is_writable() const {
+    return !IsComplete() && (nested_ == NULL || nested_->is_complete());
+  }
+
   void add_null() { Null(); }
   void add_bool(cass_bool_t value) { Bool(value != cass_false); }
   void add_int32(cass_int32_t value) { Int(value); }
   void add_int64(cass_int64_t value) { Int64(value); }
   void add_double(cass_double_t value) { Double(value); }
 
+  // Adds many numbers to an array after reserving enough space for all of
+  // them at once
+  void add_int64s(const cass_int64_t* values, size_t count);
+  void add_doubles(const cass_double_t* values, size_t count);
+
   void add_string(const char* string, size_t length) {
     String(string, static_cast<rapidjson::SizeType>(length));
   }
@@ -126,14 +175,36 @@ public:
     Key(key, static_cast<rapidjson::SizeType>(length));
   }
 
+  void add_key(const GraphObjectTemplate* object_template, size_t index) {
+    size_t length = object_template->encoded_name_length(index);
+    Prefix(rapidjson::kStringType);
+    memcpy(os_->Push(length), object_template->encoded_name(index), length);
+  }
+
   void add_point(cass_double_t x, cass_double_t y);
 
   void add_line_string(const dse::LineString* line_string) {
-    String(line_string->to_wkt().c_str());
+    add_geometry(line_string);
   }
 
   void add_polygon(const dse::Polygon* polygon) {
-    String(polygon->to_wkt().c_str());
+    add_geometry(polygon);
+  }
+
+  void add_multi_point(const dse::MultiPoint* multi_point) {
+    add_geometry(multi_point);
+  }
+
+  void add_multi_line_string(const dse::MultiLineString* multi_line_string) {
+    add_geometry(multi_line_string);
+  }
+
+  void add_multi_polygon(const dse::MultiPolygon* multi_polygon) {
+    add_geometry(multi_polygon);
+  }
+
+  void add_geometry_collection(const dse::GeometryCollection* geometry_collection) {
+    add_geometry(geometry_collection);
   }
 
   void add_writer(const GraphWriter* writer, rapidjson::Type type) {
@@ -142,7 +213,16 @@ public:
     memcpy(os_->Push(length), writer->buffer_.GetString(), length);
   }
 
+  // Nested objects and arrays are written directly into this writer's
+  // buffer. They're owned by this writer and reused by later calls so only
+  // one of each type can be open at a time.
+  GraphObject* start_nested_object();
+  GraphArray* start_nested_array();
+
+  void reserve(size_t size) { buffer_.Reserve(size); }
+
   void reset() {
+    nested_ = NULL;
     buffer_.Clear();
     Reset(buffer_);
   }
@@ -154,8 +234,37 @@ protected:
   void start_array() { StartArray(); }
   void end_array() { EndArray(); }
 
+  // Finishes the open nested object or array (and anything nested in it)
+  void finish_nested();
+
+private:
+  void attach(GraphWriter* parent) {
+    nested_ = NULL;
+    is_nested_ = true;
+    Reset(*parent->os_);
+  }
+
+private:
+  // WKT never needs to be escaped so it's written directly into the JSON
+  // buffer after reserving enough space for the largest possible output
+  template <class T>
+  void add_geometry(const T* geometry) {
+    size_t max_size = WKT_MAX_SIZE(geometry->bytes().size()) + 2; // Quotes
+    Prefix(rapidjson::kStringType);
+    WktFixedBuffer wkt(os_->Push(max_size));
+    wkt.append("\"", 1);
+    WktWriter<WktFixedBuffer> writer(wkt);
+    geometry->to_wkt(writer);
+    wkt.append("\"", 1);
+    os_->Pop(max_size - wkt.size());
+  }
+
 private:
   rapidjson::StringBuffer buffer_;
+  cass::ScopedPtr<GraphObject> nested_object_;
+  cass::ScopedPtr<GraphArray> nested_array_;
+  GraphWriter* nested_;
+  bool is_nested_;
 };
 
 class GraphObject : public GraphWriter {
@@ -170,8 +279,16 @@ public:
   }
 
   void finish() {
+    finish_nested();
     if (!is_complete()) end_object();
   }
+
+private:
+  friend class GraphWriter;
+
+  // Used for nested objects which don't write into their own buffer
+  struct Nested { };
+  explicit GraphObject(Nested) { }
 };
 
 class GraphArray : public GraphWriter {
@@ -186,8 +303,16 @@ public:
   }
 
   void finish() {
+    finish_nested();
     if (!is_complete()) end_array();
   }
+
+private:
+  friend class GraphWriter;
+
+  // Used for nested arrays which don't write into their own buffer
+  struct Nested { };
+  explicit GraphArray(Nested) { }
 };
 
 class GraphStatement {
@@ -271,6 +396,7 @@ EXTERNAL_TYPE(dse::GraphOptions, DseGraphOptions)
 EXTERNAL_TYPE(dse::GraphStatement, DseGraphStatement)
 EXTERNAL_TYPE(dse::GraphArray, DseGraphArray)
 EXTERNAL_TYPE(dse::GraphObject, DseGraphObject)
+EXTERNAL_TYPE(dse::GraphObjectTemplate, DseGraphObjectTemplate)
 EXTERNAL_TYPE(dse::GraphResultSet, DseGraphResultSet)
 EXTERNAL_TYPE(dse::GraphResult, DseGraphResult)
 
@@ -0,0 +1,73 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "graph_builder_pool.hpp"
+
+extern "C" {
+
+DseGraphBuilderPool* dse_graph_builder_pool_new(size_t max_idle) {
+  return DseGraphBuilderPool::to(new dse::GraphBuilderPool(max_idle));
+}
+
+void dse_graph_builder_pool_free(DseGraphBuilderPool* pool) {
+  delete pool->from();
+}
+
+DseGraphObject* dse_graph_builder_pool_get_object(DseGraphBuilderPool* pool) {
+  return DseGraphObject::to(pool->get_object());
+}
+
+DseGraphArray* dse_graph_builder_pool_get_array(DseGraphBuilderPool* pool) {
+  return DseGraphArray::to(pool->get_array());
+}
+
+CassError dse_graph_builder_pool_release_object(DseGraphBuilderPool* pool,
+                                                DseGraphObject* object) {
+  if (object->is_nested()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  pool->release_object(object->from());
+  return CASS_OK;
+}
+
+CassError dse_graph_builder_pool_release_array(DseGraphBuilderPool* pool,
+                                               DseGraphArray* array) {
+  if (array->is_nested()) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  pool->release_array(array->from());
+  return CASS_OK;
+}
+
+void dse_graph_builder_pool_get_stats(const DseGraphBuilderPool* pool,
+                                      DseGraphBuilderPoolStats* stats) {
+  *stats = pool->stats();
+}
+
+} // extern "C"
+
+namespace dse {
+
+GraphBuilderPool::~GraphBuilderPool() {
+  for (size_t i = 0; i < idle_objects_.size(); ++i) {
+    delete idle_objects_[i];
+  }
+  for (size_t i = 0; i < idle_arrays_.size(); ++i) {
+    delete idle_arrays_[i];
+  }
+}
+
+size_t GraphBuilderPool::common_size() const {
+  size_t common = 0;
+  for (size_t i = 1; i < DSE_GRAPH_BUILDER_POOL_NUM_SIZE_CLASSES; ++i) {
+    if (stats_.size_classes[i] > stats_.size_classes[common]) common = i;
+  }
+  // Buffers start with enough space for the smallest size class
+  return common > 0 ? DSE_GRAPH_BUILDER_POOL_SIZE_CLASS_MAX(common) : 0;
+}
+
+} // namespace dse
@@ -0,0 +1,97 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_GRAPH_BUILDER_POOL_HPP_INCLUDED__
+#define __DSE_GRAPH_BUILDER_POOL_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "graph.hpp"
+
+#include <external.hpp>
+
+#include <string.h>
+#include <vector>
+
+namespace dse {
+
+// Recycles graph objects and arrays so that their buffers don't need to be
+// reallocated. It isn't thread-safe so each thread should use its own pool.
+class GraphBuilderPool {
+public:
+  explicit GraphBuilderPool(size_t max_idle)
+    : max_idle_(max_idle) {
+    memset(&stats_, 0, sizeof(stats_));
+  }
+
+  ~GraphBuilderPool();
+
+  GraphObject* get_object() { return get(idle_objects_); }
+  GraphArray* get_array() { return get(idle_arrays_); }
+
+  void release_object(GraphObject* object) { release(object, idle_objects_); }
+  void release_array(GraphArray* array) { release(array, idle_arrays_); }
+
+  const DseGraphBuilderPoolStats& stats() const { return stats_; }
+
+private:
+  template <class T>
+  T* get(std::vector<T*>& idle);
+
+  template <class T>
+  void release(T* builder, std::vector<T*>& idle);
+
+  // The upper bound of the most common size class is used to size new
+  // builders' buffers
+  size_t common_size() const;
+
+private:
+  size_t max_idle_;
+  std::vector<GraphObject*> idle_objects_;
+  std::vector<GraphArray*> idle_arrays_;
+  DseGraphBuilderPoolStats stats_;
+};
+
+template <class T>
+T* GraphBuilderPool::get(std::vector<T*>& idle) {
+  if (!idle.empty()) {
+    // The most recently released builder is the most likely to be cached
+    T* builder = idle.back();
+    idle.pop_back();
+    stats_.hits++;
+    return builder;
+  }
+  stats_.misses++;
+  T* builder = new T();
+  builder->reserve(common_size());
+  return builder;
+}
+
+template <class T>
+void GraphBuilderPool::release(T* builder, std::vector<T*>& idle) {
+  size_t length = builder->length();
+  size_t size_class = 0;
+  while (size_class < DSE_GRAPH_BUILDER_POOL_NUM_SIZE_CLASSES - 1 &&
+         length > DSE_GRAPH_BUILDER_POOL_SIZE_CLASS_MAX(size_class)) {
+    ++size_class;
+  }
+  stats_.size_classes[size_class]++;
+
+  if (idle.size() < max_idle_) {
+    builder->reset();
+    idle.push_back(builder);
+  } else {
+    stats_.discarded++;
+    delete builder;
+  }
+}
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::GraphBuilderPool, DseGraphBuilderPool)
+
+#endif
@@ -6,13 +6,12 @@
 */
 
 #include "line_string.hpp"
+#include "geometry.hpp"
+#include "simplify.hpp"
 #include "validate.hpp"
 
-#include <string_ref.hpp>
-
-#include <assert.h>
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <new>
 
 extern "C" {
 
@@ -39,10 +38,45 @@ CassError dse_line_string_add_point(DseLineString* line_string,
   return CASS_OK;
 }
 
+CassError dse_line_string_add_points_n(DseLineString* line_string,
+                                       const cass_double_t* points,
+                                       size_t num_points) {
+  return line_string->add_points(points, num_points);
+}
+
+CassError dse_line_string_add_points_xy_n(DseLineString* line_string,
+                                          const cass_double_t* x,
+                                          const cass_double_t* y,
+                                          size_t num_points) {
+  return line_string->add_points(x, y, num_points);
+}
+
 CassError dse_line_string_finish(DseLineString* line_string) {
   return line_string->finish();
 }
 
+CassError dse_line_string_from_wkt(DseLineString* line_string,
+                                   const char* wkt) {
+  return line_string->from_wkt(wkt, strlen(wkt));
+}
+
+CassError dse_line_string_from_wkt_n(DseLineString* line_string,
+                                     const char* wkt,
+                                     size_t wkt_length) {
+  return line_string->from_wkt(wkt, wkt_length);
+}
+
+CassError dse_line_string_envelope(const DseLineString* line_string,
+                                   cass_double_t* min_x, cass_double_t* min_y,
+                                   cass_double_t* max_x, cass_double_t* max_y) {
+  return line_string->envelope(min_x, min_y, max_x, max_y);
+}
+
+CassError dse_line_string_simplify(DseLineString* line_string,
+                                   cass_double_t tolerance) {
+  return line_string->simplify(tolerance);
+}
+
 DseLineStringIterator* dse_line_string_iterator_new() {
   return DseLineStringIterator::to(new dse::LineStringIterator());
 }
@@ -51,6 +85,15 @@ void dse_line_string_iterator_free(DseLineStringIterator* iterator) {
   delete iterator->from();
 }
 
+DseLineStringIterator* dse_line_string_iterator_init(DseLineStringIteratorStorage* storage) {
+  STATIC_ASSERT(sizeof(dse::LineStringIterator) <= sizeof(DseLineStringIteratorStorage));
+  return DseLineStringIterator::to(new (storage) dse::LineStringIterator());
+}
+
+void dse_line_string_iterator_destroy(DseLineStringIterator* iterator) {
+  iterator->from()->~LineStringIterator();
+}
+
 CassError dse_line_string_iterator_reset(DseLineStringIterator *iterator, const CassValue *value) {
   return iterator->reset_binary(value);
 }
@@ -64,40 +107,90 @@ CassError dse_line_string_iterator_next_point(DseLineStringIterator* iterator,
   return iterator->next_point(x, y);
 }
 
+CassError dse_line_string_iterator_next_points(DseLineStringIterator* iterator,
+                                               const cass_byte_t** points,
+                                               cass_uint32_t* num_points) {
+  return iterator->next_points(points, num_points);
+}
+
+CassError dse_line_string_iterator_next_points_copy(DseLineStringIterator* iterator,
+                                                    cass_double_t* output,
+                                                    cass_uint32_t* num_points) {
+  return iterator->next_points_copy(output, num_points);
+}
+
+CassError dse_line_string_iterator_envelope(const DseLineStringIterator* iterator,
+                                            cass_double_t* min_x, cass_double_t* min_y,
+                                            cass_double_t* max_x, cass_double_t* max_y) {
+  return iterator->envelope(min_x, min_y, max_x, max_y);
+}
+
 } // extern "C"
 
 namespace dse {
 
-std::string LineString::to_wkt() const {
-  std::stringstream ss;
-  ss.precision(WKT_MAX_DIGITS);
-  ss << "LINESTRING (";
-  const cass_byte_t* pos = bytes_.data() + WKB_HEADER_SIZE + sizeof(cass_uint32_t);
-  for (cass_uint32_t i = 0; i < num_points_; ++i) {
-    if (i > 0) ss << ", ";
-    ss << decode_double(pos, native_byte_order());
-    pos += sizeof(cass_double_t);
-    ss << " ";
-    ss << decode_double(pos, native_byte_order());
-    pos += sizeof(cass_double_t);
+CassError LineString::from_wkt(const char* text, size_t size) {
+  // Every point except the last is followed by a comma so the exact size can
+  // be reserved without parsing the points
+  bytes_.clear();
+  envelope_.reset();
+  reserve(static_cast<cass_uint32_t>(std::count(text, text + size, ',') + 1));
+
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_LINESTRING, bytes_);
+  if (rc != CASS_OK) {
+    reset();
+    return rc;
+  }
+
+  num_points_ = decode_uint32(bytes_.data() + WKB_HEADER_SIZE, native_byte_order());
+  expand_envelope(WKB_LINE_STRING_HEADER_SIZE, num_points_);
+  return CASS_OK;
+}
+
+CassError LineString::simplify(cass_double_t tolerance) {
+  if (!(tolerance >= 0.0)) { // Also rejects NaN
+    return CASS_ERROR_LIB_BAD_PARAMS;
   }
-  ss << ")";
-  return ss.str();
+
+  cass_byte_t* points = &bytes_[0] + WKB_LINE_STRING_HEADER_SIZE;
+  Simplifier simplifier;
+  size_t num_kept = simplifier.mark(points, num_points_, tolerance);
+  cass_byte_t* end = simplifier.compact(points, num_points_, points);
+  bytes_.resize(end - &bytes_[0]);
+  num_points_ = static_cast<cass_uint32_t>(num_kept);
+  encode(num_points_, WKB_HEADER_SIZE, bytes_);
+
+  // Removed points can be on the edges of the envelope
+  envelope_.reset();
+  expand_envelope(WKB_LINE_STRING_HEADER_SIZE, num_points_);
+  return CASS_OK;
+}
+
+std::string LineString::to_wkt() const {
+  std::string wkt;
+  WktWriter<std::string> writer(wkt);
+  to_wkt(writer);
+  return wkt;
 }
 
 CassError LineStringIterator::reset_binary(const CassValue* value) {
   size_t size;
   const cass_byte_t* pos;
-  dse::WkbByteOrder byte_order;
-  cass_uint32_t num_points;
   CassError rc;
 
-  rc = dse::validate_data_type(value, DSE_LINE_STRING_TYPE);
+  rc = data_type_validator_.validate(value);
   if (rc != CASS_OK) return rc;
 
   rc = cass_value_get_bytes(value, &pos, &size);
   if (rc != CASS_OK) return rc;
 
+  return reset_binary(pos, size);
+}
+
+CassError LineStringIterator::reset_binary(const cass_byte_t* pos, size_t size) {
+  dse::WkbByteOrder byte_order;
+  cass_uint32_t num_points;
+
   if (size < WKB_LINE_STRING_HEADER_SIZE) {
     return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
   }
@@ -116,107 +209,33 @@ CassError LineStringIterator::reset_binary(const CassValue* value) {
   }
 
   num_points_ = num_points;
-  binary_iterator_ = BinaryIterator(pos, pos + size, byte_order);
-  iterator_ = &binary_iterator_;
-
-  return CASS_OK;
-}
-
-bool isnum(int c) {
-  return isdigit(c) || c == '+' || c == '-' || c == '.';
-}
-
-CassError LineStringIterator::reset_text(const char* text, size_t size) {
-  cass_uint32_t num_points = 0;
-  const bool skip_numbers = true;
-  WktLexer lexer(text, size, skip_numbers);
-
-  if (lexer.next_token() != WktLexer::TK_TYPE_LINESTRING) {
-    return CASS_ERROR_LIB_BAD_PARAMS;
-  }
-
-  // Validate format and count the number of points
-  if (lexer.next_token() != WktLexer::TK_OPEN_PAREN) {
-    return CASS_ERROR_LIB_BAD_PARAMS;
-  }
-
-  WktLexer::Token token = lexer.next_token();
-  while (token != WktLexer::TK_EOF && token != WktLexer::TK_CLOSE_PAREN) {
-    // First number in point
-    if (token != WktLexer::TK_NUMBER) {
-      return CASS_ERROR_LIB_BAD_PARAMS;
-    }
-
-    // Second number in point
-    token = lexer.next_token();
-    if (token != WktLexer::TK_NUMBER) {
-      return CASS_ERROR_LIB_BAD_PARAMS;
-    }
-
-    ++num_points;
-
-    // Check and skip "," token
-    token = lexer.next_token();
-    if (token == WktLexer::TK_COMMA) {
-      token = lexer.next_token();
-      // Verify there are more points
-      if(token != WktLexer::TK_NUMBER) {
-        return CASS_ERROR_LIB_BAD_PARAMS;
-      }
-    }
-  }
-
-  // Validate closing ")"
-  if (token != WktLexer::TK_CLOSE_PAREN) {
-    return CASS_ERROR_LIB_BAD_PARAMS;
-  }
-
-  num_points_ = num_points;
-  text_iterator_ = TextIterator(text, size);
-  iterator_ = &text_iterator_;
+  points_begin_ = pos;
+  position_ = pos;
+  points_end_ = pos + 2 * num_points * sizeof(cass_double_t);
+  byte_order_ = byte_order;
 
   return CASS_OK;
 }
 
-CassError LineStringIterator::BinaryIterator::next_point(cass_double_t* x, cass_double_t* y) {
-  if (position_ >= points_end_) {
-    return CASS_ERROR_LIB_INVALID_STATE;
+CassError LineStringIterator::envelope(cass_double_t* min_x, cass_double_t* min_y,
+                                       cass_double_t* max_x, cass_double_t* max_y) const {
+  Envelope envelope;
+  if (points_begin_ != NULL) {
+    envelope.expand(points_begin_, num_points_, byte_order_);
   }
-
-  *x = decode_double(position_, byte_order_);
-  position_ += sizeof(cass_double_t);
-  *y = decode_double(position_, byte_order_);
-  position_ += sizeof(cass_double_t);
-
-  return CASS_OK;
-}
-
-LineStringIterator::TextIterator::TextIterator(const char* text, size_t size)
-  : lexer_(text, size) {
-  WktLexer::Token token; UNUSED_(token);
-  // Skip over "LINESTRING (" tokens
-  token = lexer_.next_token(); assert(token == WktLexer::TK_TYPE_LINESTRING);
-  token = lexer_.next_token(); assert(token == WktLexer::TK_OPEN_PAREN);
+  return envelope.get(min_x, min_y, max_x, max_y);
 }
 
-CassError LineStringIterator::TextIterator::next_point(cass_double_t* x, cass_double_t* y) {
-  WktLexer::Token token;
-
-  // If we're at the end of the text this will return WktLexer::TK_EOF
-  token = lexer_.next_token();
-  if (token != WktLexer::TK_NUMBER) {
-    return CASS_ERROR_LIB_INVALID_STATE;
-  }
-  *x = lexer_.number();
-
-  token = lexer_.next_token(); assert(token == WktLexer::TK_NUMBER);
-  *y = lexer_.number();
+CassError LineStringIterator::reset_text(const char* text, size_t size) {
+  num_points_ = 0;
+  points_begin_ = position_ = points_end_ = NULL;
+  text_bytes_.clear();
 
-  // Skip trailing "," or  ")" tokens
-  token = lexer_.next_token(); assert(token == WktLexer::TK_COMMA ||
-                                      token == WktLexer::TK_CLOSE_PAREN);
+  // Validate, count and decode the points in a single pass
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_LINESTRING, text_bytes_);
+  if (rc != CASS_OK) return rc;
 
-  return CASS_OK;
+  return reset_binary(text_bytes_.data(), text_bytes_.size());
 }
 
 } // namespace dse
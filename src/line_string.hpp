@@ -10,8 +10,10 @@
 
 #include "dse.h"
 
+#include "envelope.hpp"
 #include "serialization.hpp"
-#include "wkt.hpp"
+#include "validate.hpp"
+#include "wkt_writer.hpp"
 
 #include <external.hpp>
 
@@ -28,6 +30,7 @@ public:
   const Bytes& bytes() const { return bytes_; }
 
   void reset() {
+    envelope_.reset();
     num_points_ = 0;
     bytes_.clear();
     bytes_.reserve(WKB_HEADER_SIZE +           // Header
@@ -46,9 +49,33 @@ public:
   void add_point(cass_double_t x, cass_double_t y) {
     encode_append(x, bytes_);
     encode_append(y, bytes_);
+    envelope_.expand(x, y);
     num_points_++;
   }
 
+  CassError add_points(const cass_double_t* points, size_t num_points) {
+    if (num_points > std::numeric_limits<cass_uint32_t>::max() - num_points_) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+    size_t index = bytes_.size();
+    encode_points_append(points, num_points, bytes_);
+    expand_envelope(index, num_points);
+    num_points_ += static_cast<cass_uint32_t>(num_points);
+    return CASS_OK;
+  }
+
+  CassError add_points(const cass_double_t* x, const cass_double_t* y,
+                       size_t num_points) {
+    if (num_points > std::numeric_limits<cass_uint32_t>::max() - num_points_) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+    size_t index = bytes_.size();
+    encode_points_append(x, y, num_points, bytes_);
+    expand_envelope(index, num_points);
+    num_points_ += static_cast<cass_uint32_t>(num_points);
+    return CASS_OK;
+  }
+
   CassError finish() {
     if (num_points_ == 1) {
       return CASS_ERROR_LIB_INVALID_STATE;
@@ -57,70 +84,112 @@ public:
     return CASS_OK;
   }
 
+  CassError from_wkt(const char* text, size_t size);
+
+  CassError envelope(cass_double_t* min_x, cass_double_t* min_y,
+                     cass_double_t* max_x, cass_double_t* max_y) const {
+    return envelope_.get(min_x, min_y, max_x, max_y);
+  }
+
+  CassError simplify(cass_double_t tolerance);
+
   std::string to_wkt() const;
 
+  template <class Buffer>
+  void to_wkt(WktWriter<Buffer>& writer) const {
+    writer.write_tag(WKB_GEOMETRY_TYPE_LINESTRING);
+    writer.write_points(bytes_.data() + WKB_LINE_STRING_HEADER_SIZE,
+                        num_points_, native_byte_order());
+  }
+
+private:
+  void expand_envelope(size_t index, size_t num_points) {
+    if (num_points > 0) {
+      envelope_.expand(&bytes_[index], num_points, native_byte_order());
+    }
+  }
+
 private:
   cass_uint32_t num_points_;
+  Envelope envelope_;
   Bytes bytes_;
 };
 
 class LineStringIterator {
 public:
   LineStringIterator()
-    : num_points_(0)
-    , iterator_(NULL) { }
+    : data_type_validator_(DSE_LINE_STRING_TYPE)
+    , num_points_(0)
+    , points_begin_(NULL)
+    , position_(NULL)
+    , points_end_(NULL)
+    , byte_order_(WKB_BYTE_ORDER_LITTLE_ENDIAN) { }
 
   cass_uint32_t num_points() const { return num_points_; }
 
   CassError reset_binary(const CassValue* value);
+  CassError reset_binary(const cass_byte_t* data, size_t size);
   CassError reset_text(const char* text, size_t size);
 
+  // Computed from all the points regardless of the iterator's position
+  CassError envelope(cass_double_t* min_x, cass_double_t* min_y,
+                     cass_double_t* max_x, cass_double_t* max_y) const;
+
   CassError next_point(cass_double_t* x, cass_double_t* y) {
-    if (iterator_ == NULL) {
+    if (position_ >= points_end_) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+
+    *x = decode_double(position_, byte_order_);
+    position_ += sizeof(cass_double_t);
+    *y = decode_double(position_, byte_order_);
+    position_ += sizeof(cass_double_t);
+
+    return CASS_OK;
+  }
+
+  CassError next_points(const cass_byte_t** points, cass_uint32_t* num_points) {
+    if (position_ == NULL) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+
+    // Swapped coordinates can only be copied
+    if (byte_order_ != native_byte_order()) {
+      return CASS_ERROR_LIB_NOT_IMPLEMENTED;
+    }
+
+    *points = position_;
+    *num_points = remaining();
+    position_ = points_end_;
+
+    return CASS_OK;
+  }
+
+  CassError next_points_copy(cass_double_t* output, cass_uint32_t* num_points) {
+    if (position_ == NULL) {
       return CASS_ERROR_LIB_INVALID_STATE;
     }
-    return iterator_->next_point(x, y);
+
+    *num_points = remaining();
+    decode_doubles(position_, 2 * *num_points, byte_order_, output);
+    position_ = points_end_;
+
+    return CASS_OK;
   }
 
 private:
-  class Iterator {
-  public:
-    virtual CassError next_point(cass_double_t *x, cass_double_t *y) = 0;
-  };
-
-  class BinaryIterator : public Iterator {
-  public:
-    BinaryIterator() { }
-    BinaryIterator(const cass_byte_t* points_begin,
-                   const cass_byte_t* points_end,
-                   WkbByteOrder byte_order)
-      : position_(points_begin)
-      , points_end_(points_end)
-      , byte_order_(byte_order) { }
-
-    virtual CassError next_point(cass_double_t *x, cass_double_t *y);
-
-  private:
-    const cass_byte_t* position_;
-    const cass_byte_t* points_end_;
-    WkbByteOrder byte_order_;
-  };
-
-  class TextIterator : public Iterator {
-  public:
-    TextIterator() { }
-    TextIterator(const char* text, size_t size);
-
-    virtual CassError next_point(cass_double_t *x, cass_double_t *y);
-
-  private:
-    WktLexer lexer_;
-  };
+  cass_uint32_t remaining() const {
+    return static_cast<cass_uint32_t>((points_end_ - position_) / (2 * sizeof(cass_double_t)));
+  }
 
+private:
+  DataTypeValidator data_type_validator_;
   cass_uint32_t num_points_;
-  Iterator* iterator_;
-  BinaryIterator binary_iterator_;
-  TextIterator text_iterator_;
+  const cass_byte_t* points_begin_;
+  const cass_byte_t* position_;
+  const cass_byte_t* points_end_;
+  WkbByteOrder byte_order_;
+  Bytes text_bytes_; // WKT converted to WKB so that it's only parsed once
 };
 
 } // namespace dse
@@ -0,0 +1,130 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "multi_line_string.hpp"
+#include "geometry.hpp"
+#include "validate.hpp"
+
+extern "C" {
+
+DseMultiLineString* dse_multi_line_string_new() {
+  return DseMultiLineString::to(new dse::MultiLineString());
+}
+
+void dse_multi_line_string_free(DseMultiLineString* multi_line_string) {
+  delete multi_line_string->from();
+}
+
+void dse_multi_line_string_reset(DseMultiLineString* multi_line_string) {
+  multi_line_string->reset();
+}
+
+void dse_multi_line_string_reserve(DseMultiLineString* multi_line_string,
+                                   cass_uint32_t num_line_strings,
+                                   cass_uint32_t total_num_points) {
+  multi_line_string->reserve(num_line_strings, total_num_points);
+}
+
+CassError dse_multi_line_string_start_line_string(DseMultiLineString* multi_line_string) {
+  return multi_line_string->start_line_string();
+}
+
+CassError dse_multi_line_string_add_point(DseMultiLineString* multi_line_string,
+                                          cass_double_t x, cass_double_t y) {
+  return multi_line_string->add_point(x, y);
+}
+
+CassError dse_multi_line_string_finish(DseMultiLineString* multi_line_string) {
+  return multi_line_string->finish();
+}
+
+DseMultiLineStringIterator* dse_multi_line_string_iterator_new() {
+  return DseMultiLineStringIterator::to(new dse::MultiLineStringIterator());
+}
+
+void dse_multi_line_string_iterator_free(DseMultiLineStringIterator* iterator) {
+  delete iterator->from();
+}
+
+CassError dse_multi_line_string_iterator_reset(DseMultiLineStringIterator* iterator,
+                                               const CassValue* value) {
+  return iterator->reset_binary(value);
+}
+
+cass_uint32_t dse_multi_line_string_iterator_num_line_strings(const DseMultiLineStringIterator* iterator) {
+  return iterator->num_line_strings();
+}
+
+CassError dse_multi_line_string_iterator_next_line_string(DseMultiLineStringIterator* iterator,
+                                                          DseLineStringIterator* line_string) {
+  return iterator->next_line_string(line_string);
+}
+
+} // extern "C"
+
+namespace dse {
+
+std::string MultiLineString::to_wkt() const {
+  std::string wkt;
+  WktWriter<std::string> writer(wkt);
+  to_wkt(writer);
+  return wkt;
+}
+
+CassError MultiLineStringIterator::reset_binary(const CassValue* value) {
+  size_t size;
+  const cass_byte_t* pos;
+
+  CassError rc = data_type_validator_.validate(value);
+  if (rc != CASS_OK) return rc;
+
+  rc = cass_value_get_bytes(value, &pos, &size);
+  if (rc != CASS_OK) return rc;
+
+  return reset_binary(pos, size);
+}
+
+CassError MultiLineStringIterator::reset_binary(const cass_byte_t* data, size_t size) {
+  cass_uint32_t num_line_strings;
+  const cass_byte_t* end;
+
+  CassError rc = decode_multi_geometry(data, size,
+                                       WKB_GEOMETRY_TYPE_MULTILINESTRING,
+                                       &num_line_strings, &end);
+  if (rc != CASS_OK) return rc;
+
+  num_line_strings_ = num_line_strings;
+  position_ = data + WKB_MULTI_HEADER_SIZE;
+  end_ = end;
+
+  return CASS_OK;
+}
+
+CassError MultiLineStringIterator::reset_text(const char* text, size_t size) {
+  num_line_strings_ = 0;
+  position_ = end_ = NULL;
+  text_bytes_.clear();
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_MULTILINESTRING, text_bytes_);
+  if (rc != CASS_OK) return rc;
+  return reset_binary(text_bytes_.data(), text_bytes_.size());
+}
+
+CassError MultiLineStringIterator::next_line_string(LineStringIterator* line_string) {
+  size_t size;
+
+  if (position_ >= end_ ||
+      !decode_geometry_size(position_, end_ - position_, &size)) {
+    return CASS_ERROR_LIB_INVALID_STATE;
+  }
+
+  CassError rc = line_string->reset_binary(position_, size);
+  position_ += size;
+
+  return rc;
+}
+
+} // namespace dse
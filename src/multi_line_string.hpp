@@ -0,0 +1,131 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_MULTI_LINE_STRING_HPP_INCLUDED__
+#define __DSE_MULTI_LINE_STRING_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "line_string.hpp"
+#include "serialization.hpp"
+#include "validate.hpp"
+#include "wkt_writer.hpp"
+
+#include <external.hpp>
+
+#include <string>
+
+namespace dse {
+
+class MultiLineString {
+public:
+  MultiLineString() {
+    reset();
+  }
+
+  const Bytes& bytes() const { return bytes_; }
+
+  void reset() {
+    num_line_strings_ = 0;
+    num_points_ = 0;
+    line_string_start_index_ = 0;
+    bytes_.clear();
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE +       // Header and num line strings
+                   WKB_LINE_STRING_HEADER_SIZE + // Header and num points for one line string
+                   4 * sizeof(cass_double_t));   // Simplest line string is 2 points
+    encode_header_append(WKB_GEOMETRY_TYPE_MULTILINESTRING, bytes_);
+    encode_append(0u, bytes_);
+  }
+
+  void reserve(cass_uint32_t num_line_strings, cass_uint32_t total_num_points) {
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE +
+                   num_line_strings * WKB_LINE_STRING_HEADER_SIZE +
+                   2 * total_num_points * sizeof(cass_double_t));
+  }
+
+  CassError start_line_string() {
+    CassError rc = finish_line_string(); // Finish the previous line string
+    if (rc != CASS_OK) return rc;
+    line_string_start_index_ = bytes_.size();
+    encode_header_append(WKB_GEOMETRY_TYPE_LINESTRING, bytes_);
+    encode_append(0u, bytes_); // Start the line string with zero points
+    num_line_strings_++;
+    return CASS_OK;
+  }
+
+  CassError add_point(cass_double_t x, cass_double_t y) {
+    if (line_string_start_index_ == 0) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+    encode_append(x, bytes_);
+    encode_append(y, bytes_);
+    num_points_++;
+    return CASS_OK;
+  }
+
+  CassError finish() {
+    encode(num_line_strings_, WKB_HEADER_SIZE, bytes_);
+    return finish_line_string(); // Finish the last line string
+  }
+
+  std::string to_wkt() const;
+
+  template <class Buffer>
+  void to_wkt(WktWriter<Buffer>& writer) const {
+    writer.write_geometry(bytes_.data(), true);
+  }
+
+private:
+  CassError finish_line_string() {
+    if (line_string_start_index_ > 0) {
+      if (num_points_ == 1) {
+        return CASS_ERROR_LIB_INVALID_STATE;
+      }
+      encode(num_points_, line_string_start_index_ + WKB_HEADER_SIZE, bytes_);
+      num_points_ = 0;
+      line_string_start_index_ = 0;
+    }
+    return CASS_OK;
+  }
+
+private:
+  cass_uint32_t num_line_strings_;
+  cass_uint32_t num_points_;
+  size_t line_string_start_index_;
+  Bytes bytes_;
+};
+
+class MultiLineStringIterator {
+public:
+  MultiLineStringIterator()
+    : data_type_validator_(DSE_MULTI_LINE_STRING_TYPE)
+    , num_line_strings_(0)
+    , position_(NULL)
+    , end_(NULL) { }
+
+  cass_uint32_t num_line_strings() const { return num_line_strings_; }
+
+  CassError reset_binary(const CassValue* value);
+  CassError reset_binary(const cass_byte_t* data, size_t size);
+  CassError reset_text(const char* text, size_t size);
+
+  CassError next_line_string(LineStringIterator* line_string);
+
+private:
+  DataTypeValidator data_type_validator_;
+  cass_uint32_t num_line_strings_;
+  const cass_byte_t* position_;
+  const cass_byte_t* end_;
+  Bytes text_bytes_;
+};
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::MultiLineString, DseMultiLineString)
+EXTERNAL_TYPE(dse::MultiLineStringIterator, DseMultiLineStringIterator)
+
+#endif
@@ -0,0 +1,130 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "multi_point.hpp"
+#include "geometry.hpp"
+#include "validate.hpp"
+
+extern "C" {
+
+DseMultiPoint* dse_multi_point_new() {
+  return DseMultiPoint::to(new dse::MultiPoint());
+}
+
+void dse_multi_point_free(DseMultiPoint* multi_point) {
+  delete multi_point->from();
+}
+
+void dse_multi_point_reset(DseMultiPoint* multi_point) {
+  multi_point->reset();
+}
+
+void dse_multi_point_reserve(DseMultiPoint* multi_point,
+                             cass_uint32_t num_points) {
+  multi_point->reserve(num_points);
+}
+
+CassError dse_multi_point_add_point(DseMultiPoint* multi_point,
+                                    cass_double_t x, cass_double_t y) {
+  multi_point->add_point(x, y);
+  return CASS_OK;
+}
+
+CassError dse_multi_point_finish(DseMultiPoint* multi_point) {
+  return multi_point->finish();
+}
+
+DseMultiPointIterator* dse_multi_point_iterator_new() {
+  return DseMultiPointIterator::to(new dse::MultiPointIterator());
+}
+
+void dse_multi_point_iterator_free(DseMultiPointIterator* iterator) {
+  delete iterator->from();
+}
+
+CassError dse_multi_point_iterator_reset(DseMultiPointIterator* iterator,
+                                         const CassValue* value) {
+  return iterator->reset_binary(value);
+}
+
+cass_uint32_t dse_multi_point_iterator_num_points(const DseMultiPointIterator* iterator) {
+  return iterator->num_points();
+}
+
+CassError dse_multi_point_iterator_next_point(DseMultiPointIterator* iterator,
+                                              cass_double_t* x, cass_double_t* y) {
+  return iterator->next_point(x, y);
+}
+
+} // extern "C"
+
+namespace dse {
+
+std::string MultiPoint::to_wkt() const {
+  std::string wkt;
+  WktWriter<std::string> writer(wkt);
+  to_wkt(writer);
+  return wkt;
+}
+
+CassError MultiPointIterator::reset_binary(const CassValue* value) {
+  size_t size;
+  const cass_byte_t* pos;
+
+  CassError rc = data_type_validator_.validate(value);
+  if (rc != CASS_OK) return rc;
+
+  rc = cass_value_get_bytes(value, &pos, &size);
+  if (rc != CASS_OK) return rc;
+
+  return reset_binary(pos, size);
+}
+
+CassError MultiPointIterator::reset_binary(const cass_byte_t* data, size_t size) {
+  cass_uint32_t num_points;
+  const cass_byte_t* end;
+
+  CassError rc = decode_multi_geometry(data, size,
+                                       WKB_GEOMETRY_TYPE_MULTIPOINT,
+                                       &num_points, &end);
+  if (rc != CASS_OK) return rc;
+
+  num_points_ = num_points;
+  position_ = data + WKB_MULTI_HEADER_SIZE;
+  end_ = end;
+
+  return CASS_OK;
+}
+
+CassError MultiPointIterator::reset_text(const char* text, size_t size) {
+  num_points_ = 0;
+  position_ = end_ = NULL;
+  text_bytes_.clear();
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_MULTIPOINT, text_bytes_);
+  if (rc != CASS_OK) return rc;
+  return reset_binary(text_bytes_.data(), text_bytes_.size());
+}
+
+CassError MultiPointIterator::next_point(cass_double_t* x, cass_double_t* y) {
+  if (position_ >= end_) {
+    return CASS_ERROR_LIB_INVALID_STATE;
+  }
+
+  // Each point has its own header and byte order
+  WkbByteOrder byte_order;
+  decode_header(position_, &byte_order);
+  position_ += WKB_HEADER_SIZE;
+
+  *x = decode_double(position_, byte_order);
+  position_ += sizeof(cass_double_t);
+  *y = decode_double(position_, byte_order);
+  position_ += sizeof(cass_double_t);
+
+  return CASS_OK;
+}
+
+} // namespace dse
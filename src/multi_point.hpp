@@ -0,0 +1,98 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_MULTI_POINT_HPP_INCLUDED__
+#define __DSE_MULTI_POINT_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+#include "validate.hpp"
+#include "wkt_writer.hpp"
+
+#include <external.hpp>
+
+#include <string>
+
+namespace dse {
+
+class MultiPoint {
+public:
+  MultiPoint() {
+    reset();
+  }
+
+  const Bytes& bytes() const { return bytes_; }
+
+  void reset() {
+    num_points_ = 0;
+    bytes_.clear();
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE + // Header and num points
+                   2 * WKB_POINT_SIZE);    // Two points
+    encode_header_append(WKB_GEOMETRY_TYPE_MULTIPOINT, bytes_);
+    encode_append(0u, bytes_);
+  }
+
+  void reserve(cass_uint32_t num_points) {
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE +
+                   num_points * WKB_POINT_SIZE);
+  }
+
+  void add_point(cass_double_t x, cass_double_t y) {
+    encode_header_append(WKB_GEOMETRY_TYPE_POINT, bytes_);
+    encode_append(x, bytes_);
+    encode_append(y, bytes_);
+    num_points_++;
+  }
+
+  CassError finish() {
+    encode(num_points_, WKB_HEADER_SIZE, bytes_);
+    return CASS_OK;
+  }
+
+  std::string to_wkt() const;
+
+  template <class Buffer>
+  void to_wkt(WktWriter<Buffer>& writer) const {
+    writer.write_geometry(bytes_.data(), true);
+  }
+
+private:
+  cass_uint32_t num_points_;
+  Bytes bytes_;
+};
+
+class MultiPointIterator {
+public:
+  MultiPointIterator()
+    : data_type_validator_(DSE_MULTI_POINT_TYPE)
+    , num_points_(0)
+    , position_(NULL)
+    , end_(NULL) { }
+
+  cass_uint32_t num_points() const { return num_points_; }
+
+  CassError reset_binary(const CassValue* value);
+  CassError reset_binary(const cass_byte_t* data, size_t size);
+  CassError reset_text(const char* text, size_t size);
+
+  CassError next_point(cass_double_t* x, cass_double_t* y);
+
+private:
+  DataTypeValidator data_type_validator_;
+  cass_uint32_t num_points_;
+  const cass_byte_t* position_;
+  const cass_byte_t* end_;
+  Bytes text_bytes_;
+};
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::MultiPoint, DseMultiPoint)
+EXTERNAL_TYPE(dse::MultiPointIterator, DseMultiPointIterator)
+
+#endif
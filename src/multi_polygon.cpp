@@ -0,0 +1,136 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "multi_polygon.hpp"
+#include "geometry.hpp"
+#include "validate.hpp"
+
+extern "C" {
+
+DseMultiPolygon* dse_multi_polygon_new() {
+  return DseMultiPolygon::to(new dse::MultiPolygon());
+}
+
+void dse_multi_polygon_free(DseMultiPolygon* multi_polygon) {
+  delete multi_polygon->from();
+}
+
+void dse_multi_polygon_reset(DseMultiPolygon* multi_polygon) {
+  multi_polygon->reset();
+}
+
+void dse_multi_polygon_reserve(DseMultiPolygon* multi_polygon,
+                               cass_uint32_t num_polygons,
+                               cass_uint32_t total_num_rings,
+                               cass_uint32_t total_num_points) {
+  multi_polygon->reserve(num_polygons, total_num_rings, total_num_points);
+}
+
+CassError dse_multi_polygon_start_polygon(DseMultiPolygon* multi_polygon) {
+  return multi_polygon->start_polygon();
+}
+
+CassError dse_multi_polygon_start_ring(DseMultiPolygon* multi_polygon) {
+  return multi_polygon->start_ring();
+}
+
+CassError dse_multi_polygon_add_point(DseMultiPolygon* multi_polygon,
+                                      cass_double_t x, cass_double_t y) {
+  return multi_polygon->add_point(x, y);
+}
+
+CassError dse_multi_polygon_finish(DseMultiPolygon* multi_polygon) {
+  return multi_polygon->finish();
+}
+
+DseMultiPolygonIterator* dse_multi_polygon_iterator_new() {
+  return DseMultiPolygonIterator::to(new dse::MultiPolygonIterator());
+}
+
+void dse_multi_polygon_iterator_free(DseMultiPolygonIterator* iterator) {
+  delete iterator->from();
+}
+
+CassError dse_multi_polygon_iterator_reset(DseMultiPolygonIterator* iterator,
+                                           const CassValue* value) {
+  return iterator->reset_binary(value);
+}
+
+cass_uint32_t dse_multi_polygon_iterator_num_polygons(const DseMultiPolygonIterator* iterator) {
+  return iterator->num_polygons();
+}
+
+CassError dse_multi_polygon_iterator_next_polygon(DseMultiPolygonIterator* iterator,
+                                                  DsePolygonIterator* polygon) {
+  return iterator->next_polygon(polygon);
+}
+
+} // extern "C"
+
+namespace dse {
+
+std::string MultiPolygon::to_wkt() const {
+  std::string wkt;
+  WktWriter<std::string> writer(wkt);
+  to_wkt(writer);
+  return wkt;
+}
+
+CassError MultiPolygonIterator::reset_binary(const CassValue* value) {
+  size_t size;
+  const cass_byte_t* pos;
+
+  CassError rc = data_type_validator_.validate(value);
+  if (rc != CASS_OK) return rc;
+
+  rc = cass_value_get_bytes(value, &pos, &size);
+  if (rc != CASS_OK) return rc;
+
+  return reset_binary(pos, size);
+}
+
+CassError MultiPolygonIterator::reset_binary(const cass_byte_t* data, size_t size) {
+  cass_uint32_t num_polygons;
+  const cass_byte_t* end;
+
+  CassError rc = decode_multi_geometry(data, size,
+                                       WKB_GEOMETRY_TYPE_MULTIPOLYGON,
+                                       &num_polygons, &end);
+  if (rc != CASS_OK) return rc;
+
+  num_polygons_ = num_polygons;
+  position_ = data + WKB_MULTI_HEADER_SIZE;
+  end_ = end;
+
+  return CASS_OK;
+}
+
+CassError MultiPolygonIterator::reset_text(const char* text, size_t size) {
+  num_polygons_ = 0;
+  position_ = end_ = NULL;
+  text_bytes_.clear();
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_MULTIPOLYGON, text_bytes_);
+  if (rc != CASS_OK) return rc;
+  return reset_binary(text_bytes_.data(), text_bytes_.size());
+}
+
+CassError MultiPolygonIterator::next_polygon(PolygonIterator* polygon) {
+  size_t size;
+
+  if (position_ >= end_ ||
+      !decode_geometry_size(position_, end_ - position_, &size)) {
+    return CASS_ERROR_LIB_INVALID_STATE;
+  }
+
+  // Already validated by decode_geometry_size()
+  CassError rc = polygon->reset_binary_unchecked(position_, size);
+  position_ += size;
+
+  return rc;
+}
+
+} // namespace dse
@@ -0,0 +1,165 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_MULTI_POLYGON_HPP_INCLUDED__
+#define __DSE_MULTI_POLYGON_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "polygon.hpp"
+#include "serialization.hpp"
+#include "validate.hpp"
+#include "wkt_writer.hpp"
+
+#include <external.hpp>
+
+#include <string>
+
+namespace dse {
+
+class MultiPolygon {
+public:
+  MultiPolygon() {
+    reset();
+  }
+
+  const Bytes& bytes() const { return bytes_; }
+
+  void reset() {
+    num_polygons_ = 0;
+    num_rings_ = 0;
+    num_points_ = 0;
+    polygon_start_index_ = 0;
+    ring_start_index_ = 0;
+    bytes_.clear();
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE +   // Header and num polygons
+                   WKB_POLYGON_HEADER_SIZE + // Header and num rings for one polygon
+                   sizeof(cass_uint32_t) +   // Num points for one ring
+                   6 * sizeof(cass_double_t)); // Simplest ring is 3 points
+    encode_header_append(WKB_GEOMETRY_TYPE_MULTIPOLYGON, bytes_);
+    encode_append(0u, bytes_);
+  }
+
+  void reserve(cass_uint32_t num_polygons,
+               cass_uint32_t total_num_rings,
+               cass_uint32_t total_num_points) {
+    bytes_.reserve(WKB_MULTI_HEADER_SIZE +                        // Header and num polygons
+                   num_polygons * WKB_POLYGON_HEADER_SIZE +       // Header and num rings for each polygon
+                   total_num_rings * sizeof(cass_uint32_t) +      // Num points for each ring
+                   2 * total_num_points * sizeof(cass_double_t)); // Points for each ring
+  }
+
+  CassError start_polygon() {
+    CassError rc = finish_polygon(); // Finish the previous polygon
+    if (rc != CASS_OK) return rc;
+    polygon_start_index_ = bytes_.size();
+    encode_header_append(WKB_GEOMETRY_TYPE_POLYGON, bytes_);
+    encode_append(0u, bytes_); // Start the polygon with zero rings
+    num_polygons_++;
+    return CASS_OK;
+  }
+
+  CassError start_ring() {
+    if (polygon_start_index_ == 0) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+    CassError rc = finish_ring(); // Finish the previous ring
+    if (rc != CASS_OK) return rc;
+    ring_start_index_ = bytes_.size();
+    encode_append(0u, bytes_); // Start the ring with zero points
+    num_rings_++;
+    return CASS_OK;
+  }
+
+  CassError add_point(cass_double_t x, cass_double_t y) {
+    if (ring_start_index_ == 0) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+    encode_append(x, bytes_);
+    encode_append(y, bytes_);
+    num_points_++;
+    return CASS_OK;
+  }
+
+  CassError finish() {
+    encode(num_polygons_, WKB_HEADER_SIZE, bytes_);
+    return finish_polygon(); // Finish the last polygon
+  }
+
+  std::string to_wkt() const;
+
+  template <class Buffer>
+  void to_wkt(WktWriter<Buffer>& writer) const {
+    writer.write_geometry(bytes_.data(), true);
+  }
+
+private:
+  CassError finish_polygon() {
+    if (polygon_start_index_ > 0) {
+      if (num_rings_ == 0) {
+        return CASS_ERROR_LIB_INVALID_STATE;
+      }
+      CassError rc = finish_ring(); // Finish the polygon's last ring
+      if (rc != CASS_OK) return rc;
+      encode(num_rings_, polygon_start_index_ + WKB_HEADER_SIZE, bytes_);
+      num_rings_ = 0;
+      polygon_start_index_ = 0;
+    }
+    return CASS_OK;
+  }
+
+  CassError finish_ring() {
+    if (ring_start_index_ > 0) {
+      if (num_points_ == 1 || num_points_ == 2) {
+        return CASS_ERROR_LIB_INVALID_STATE;
+      }
+      encode(num_points_, ring_start_index_, bytes_);
+      num_points_ = 0;
+      ring_start_index_ = 0;
+    }
+    return CASS_OK;
+  }
+
+private:
+  cass_uint32_t num_polygons_;
+  cass_uint32_t num_rings_;
+  cass_uint32_t num_points_;
+  size_t polygon_start_index_;
+  size_t ring_start_index_;
+  Bytes bytes_;
+};
+
+class MultiPolygonIterator {
+public:
+  MultiPolygonIterator()
+    : data_type_validator_(DSE_MULTI_POLYGON_TYPE)
+    , num_polygons_(0)
+    , position_(NULL)
+    , end_(NULL) { }
+
+  cass_uint32_t num_polygons() const { return num_polygons_; }
+
+  CassError reset_binary(const CassValue* value);
+  CassError reset_binary(const cass_byte_t* data, size_t size);
+  CassError reset_text(const char* text, size_t size);
+
+  CassError next_polygon(PolygonIterator* polygon);
+
+private:
+  DataTypeValidator data_type_validator_;
+  cass_uint32_t num_polygons_;
+  const cass_byte_t* position_;
+  const cass_byte_t* end_;
+  Bytes text_bytes_;
+};
+
+} // namespace dse
+
+EXTERNAL_TYPE(dse::MultiPolygon, DseMultiPolygon)
+EXTERNAL_TYPE(dse::MultiPolygonIterator, DseMultiPolygonIterator)
+
+#endif
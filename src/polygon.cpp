@@ -6,11 +6,13 @@
 */
 
 #include "polygon.hpp"
+#include "geometry.hpp"
+#include "simplify.hpp"
+#include "spatial.hpp"
 #include "validate.hpp"
 
 #include <assert.h>
-#include <iomanip>
-#include <sstream>
+#include <new>
 
 extern "C" {
 
@@ -42,10 +44,58 @@ CassError dse_polygon_add_point(DsePolygon* polygon,
   return CASS_OK;
 }
 
+CassError dse_polygon_add_points_n(DsePolygon* polygon,
+                                   const cass_double_t* points,
+                                   size_t num_points) {
+  return polygon->add_points(points, num_points);
+}
+
+CassError dse_polygon_add_points_xy_n(DsePolygon* polygon,
+                                      const cass_double_t* x,
+                                      const cass_double_t* y,
+                                      size_t num_points) {
+  return polygon->add_points(x, y, num_points);
+}
+
 CassError dse_polygon_finish(DsePolygon* polygon) {
   return polygon->finish();
 }
 
+CassError dse_polygon_from_wkt(DsePolygon* polygon,
+                               const char* wkt) {
+  return polygon->from_wkt(wkt, strlen(wkt));
+}
+
+CassError dse_polygon_from_wkt_n(DsePolygon* polygon,
+                                 const char* wkt,
+                                 size_t wkt_length) {
+  return polygon->from_wkt(wkt, wkt_length);
+}
+
+CassError dse_polygon_envelope(const DsePolygon* polygon,
+                               cass_double_t* min_x, cass_double_t* min_y,
+                               cass_double_t* max_x, cass_double_t* max_y) {
+  return polygon->envelope(min_x, min_y, max_x, max_y);
+}
+
+CassError dse_polygon_contains_point(const DsePolygon* polygon,
+                                     cass_double_t x, cass_double_t y,
+                                     cass_bool_t* contains) {
+  return polygon->contains_point(x, y, contains);
+}
+
+CassError dse_polygon_intersects_box(const DsePolygon* polygon,
+                                     cass_double_t min_x, cass_double_t min_y,
+                                     cass_double_t max_x, cass_double_t max_y,
+                                     cass_bool_t* intersects) {
+  return polygon->intersects_box(min_x, min_y, max_x, max_y, intersects);
+}
+
+CassError dse_polygon_simplify(DsePolygon* polygon,
+                               cass_double_t tolerance) {
+  return polygon->simplify(tolerance);
+}
+
 DsePolygonIterator* dse_polygon_iterator_new() {
   return DsePolygonIterator::to(new dse::PolygonIterator());
 }
@@ -59,6 +109,20 @@ void dse_polygon_iterator_free(DsePolygonIterator* iterator) {
   delete iterator->from();
 }
 
+DsePolygonIterator* dse_polygon_iterator_init(DsePolygonIteratorStorage* storage) {
+  STATIC_ASSERT(sizeof(dse::PolygonIterator) <= sizeof(DsePolygonIteratorStorage));
+  return DsePolygonIterator::to(new (storage) dse::PolygonIterator());
+}
+
+void dse_polygon_iterator_destroy(DsePolygonIterator* iterator) {
+  iterator->from()->~PolygonIterator();
+}
+
+CassError dse_polygon_iterator_reset_trusted(DsePolygonIterator* iterator,
+                                             const CassValue* value) {
+  return iterator->reset_binary_trusted(value);
+}
+
 cass_uint32_t dse_polygon_iterator_num_rings(const DsePolygonIterator* iterator) {
   return iterator->num_rings();
 }
@@ -68,51 +132,183 @@ CassError dse_polygon_iterator_next_num_points(DsePolygonIterator* iterator,
   return iterator->next_num_points(num_points);
 }
 
+CassError dse_polygon_iterator_seek_ring(DsePolygonIterator* iterator,
+                                        cass_uint32_t ring_index) {
+  return iterator->seek_ring(ring_index);
+}
+
+CassError dse_polygon_iterator_ring_num_points(const DsePolygonIterator* iterator,
+                                               cass_uint32_t ring_index,
+                                               cass_uint32_t* num_points) {
+  return iterator->ring_num_points(ring_index, num_points);
+}
+
 CassError dse_polygon_iterator_next_point(DsePolygonIterator* iterator,
                                           cass_double_t* x, cass_double_t* y) {
   return iterator->next_point(x, y);
 }
 
+CassError dse_polygon_iterator_next_points(DsePolygonIterator* iterator,
+                                           const cass_byte_t** points,
+                                           cass_uint32_t* num_points) {
+  return iterator->next_points(points, num_points);
+}
+
+CassError dse_polygon_iterator_next_points_copy(DsePolygonIterator* iterator,
+                                                cass_double_t* output,
+                                                cass_uint32_t* num_points) {
+  return iterator->next_points_copy(output, num_points);
+}
+
+CassError dse_polygon_iterator_envelope(const DsePolygonIterator* iterator,
+                                        cass_double_t* min_x, cass_double_t* min_y,
+                                        cass_double_t* max_x, cass_double_t* max_y) {
+  return iterator->envelope(min_x, min_y, max_x, max_y);
+}
+
+CassError dse_polygon_iterator_contains_point(const DsePolygonIterator* iterator,
+                                              cass_double_t x, cass_double_t y,
+                                              cass_bool_t* contains) {
+  return iterator->contains_point(x, y, contains);
+}
+
+CassError dse_polygon_iterator_intersects_box(const DsePolygonIterator* iterator,
+                                              cass_double_t min_x, cass_double_t min_y,
+                                              cass_double_t max_x, cass_double_t max_y,
+                                              cass_bool_t* intersects) {
+  return iterator->intersects_box(min_x, min_y, max_x, max_y, intersects);
+}
+
 } // extern "C"
 
 namespace dse {
 
-std::string Polygon::to_wkt() const {
-  std::stringstream ss;
-  ss.precision(WKT_MAX_DIGITS);
-  ss << "POLYGON (";
-  const cass_byte_t* pos = bytes_.data() + WKB_HEADER_SIZE + sizeof(cass_uint32_t);
+CassError Polygon::from_wkt(const char* text, size_t size) {
+  // Every ring opens with "(" and every point except the last is followed by
+  // a comma (the last point of a ring is followed by the comma between the
+  // rings) so the exact size can be reserved without parsing the points
+  cass_uint32_t num_parens = 0;
+  cass_uint32_t num_commas = 0;
+  for (const char* c = text; c != text + size; ++c) {
+    if (*c == '(') ++num_parens;
+    else if (*c == ',') ++num_commas;
+  }
+  bytes_.clear();
+  envelope_.reset();
+  reserve(num_parens > 0 ? num_parens - 1 : 0, num_commas + 1);
+
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_POLYGON, bytes_);
+  if (rc != CASS_OK) {
+    reset();
+    return rc;
+  }
+
+  num_rings_ = decode_uint32(bytes_.data() + WKB_HEADER_SIZE, native_byte_order());
+  num_points_ = 0;
+  ring_start_index_ = 0;
+  envelope_.expand_rings(bytes_.data() + WKB_POLYGON_HEADER_SIZE, num_rings_,
+                         native_byte_order());
+  return CASS_OK;
+}
+
+CassError Polygon::contains_point(cass_double_t x, cass_double_t y,
+                                  cass_bool_t* contains) const {
+  if (ring_start_index_ > 0) {
+    return CASS_ERROR_LIB_INVALID_STATE; // The last ring isn't finished
+  }
+  *contains = envelope_.intersects(x, y, x, y) &&
+              rings_contain_point(bytes_.data() + WKB_POLYGON_HEADER_SIZE,
+                                  num_rings_, native_byte_order(), x, y)
+              ? cass_true : cass_false;
+  return CASS_OK;
+}
+
+CassError Polygon::intersects_box(cass_double_t min_x, cass_double_t min_y,
+                                  cass_double_t max_x, cass_double_t max_y,
+                                  cass_bool_t* intersects) const {
+  if (!(min_x <= max_x && min_y <= max_y)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  if (ring_start_index_ > 0) {
+    return CASS_ERROR_LIB_INVALID_STATE; // The last ring isn't finished
+  }
+  *intersects = envelope_.intersects(min_x, min_y, max_x, max_y) &&
+                rings_intersect_box(bytes_.data() + WKB_POLYGON_HEADER_SIZE,
+                                    num_rings_, native_byte_order(),
+                                    min_x, min_y, max_x, max_y)
+                ? cass_true : cass_false;
+  return CASS_OK;
+}
+
+CassError Polygon::simplify(cass_double_t tolerance) {
+  if (!(tolerance >= 0.0)) { // Also rejects NaN
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  if (ring_start_index_ > 0) {
+    return CASS_ERROR_LIB_INVALID_STATE; // The last ring isn't finished
+  }
+
+  // The rings are simplified one at a time and moved towards the start of
+  // the buffer to fill in the space left by the removed points
+  cass_byte_t* data = &bytes_[0];
+  cass_byte_t* input = data + WKB_POLYGON_HEADER_SIZE;
+  cass_byte_t* output = input;
+  Simplifier simplifier;
   for (cass_uint32_t i = 0; i < num_rings_; ++i) {
-    if (i > 0) ss << ", ";
-    ss << "(";
-    cass_uint32_t num_points = decode_uint32(pos, native_byte_order());
-    pos += sizeof(cass_uint32_t);
-    for (cass_uint32_t j = 0; j < num_points; ++j) {
-      if (j > 0) ss << ", ";
-      ss << decode_double(pos, native_byte_order());
-      pos += sizeof(cass_double_t);
-      ss << " ";
-      ss << decode_double(pos, native_byte_order());
-      pos += sizeof(cass_double_t);
+    cass_uint32_t num_points = decode_uint32(input, native_byte_order());
+    size_t ring_size = sizeof(cass_uint32_t) + 2 * num_points * sizeof(cass_double_t);
+    const cass_byte_t* points = input + sizeof(cass_uint32_t);
+
+    size_t num_kept = simplifier.mark(points, num_points, tolerance);
+    if (num_kept < 4 && num_kept < num_points) {
+      // Too few points are left for a closed ring so it's kept as it is
+      memmove(output, input, ring_size);
+      output += ring_size;
+    } else {
+      cass_byte_t* end = simplifier.compact(points, num_points, output + sizeof(cass_uint32_t));
+      encode(static_cast<cass_uint32_t>(num_kept), output - data, bytes_);
+      output = end;
     }
-    ss << ")";
+    input += ring_size;
   }
-  ss << ")";
-  return ss.str();
+  bytes_.resize(output - data);
+
+  // Removed points can be on the edges of the envelope
+  envelope_.reset();
+  envelope_.expand_rings(&bytes_[0] + WKB_POLYGON_HEADER_SIZE, num_rings_,
+                         native_byte_order());
+  return CASS_OK;
+}
+
+std::string Polygon::to_wkt() const {
+  std::string wkt;
+  WktWriter<std::string> writer(wkt);
+  to_wkt(writer);
+  return wkt;
 }
 
 CassError PolygonIterator::reset_binary(const CassValue* value) {
   size_t size;
   const cass_byte_t* pos;
-  dse::WkbByteOrder byte_order;
-  cass_uint32_t num_rings;
 
-  CassError rc = dse::validate_data_type(value, DSE_POLYGON_TYPE);
+  CassError rc = data_type_validator_.validate(value);
   if (rc != CASS_OK) return rc;
 
   rc = cass_value_get_bytes(value, &pos, &size);
   if (rc != CASS_OK) return rc;
 
+  return reset_binary(pos, size);
+}
+
+CassError PolygonIterator::reset_binary(const cass_byte_t* pos, size_t size) {
+  dse::WkbByteOrder byte_order;
+  cass_uint32_t num_rings;
+
+  num_rings_ = 0;
+  state_ = STATE_DONE;
+  rings_begin_ = NULL;
+  rings_.clear();
+
   if (size < WKB_POLYGON_HEADER_SIZE) {
     return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
   }
@@ -127,7 +323,6 @@ CassError PolygonIterator::reset_binary(const CassValue* value) {
   pos += sizeof(cass_uint32_t);
 
   const cass_byte_t* rings = pos;
-  const cass_byte_t* rings_end = pos + size;
 
   for (cass_uint32_t i = 0; i < num_rings; ++i) {
     cass_uint32_t num_points;
@@ -144,202 +339,163 @@ CassError PolygonIterator::reset_binary(const CassValue* value) {
       return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
     }
     size -= 2 * num_points * sizeof(cass_double_t);
+    pos += 2 * num_points * sizeof(cass_double_t);
   }
 
   num_rings_ = num_rings;
-  binary_iterator_ = BinaryIterator(rings, rings_end, byte_order);
-  iterator_ = &binary_iterator_;
+  state_ = rings < pos ? STATE_NUM_POINTS : STATE_DONE;
+  rings_begin_ = rings;
+  position_ = rings;
+  rings_end_ = pos;
+  points_end_ = NULL;
+  byte_order_ = byte_order;
+  rings_checked_ = true;
 
   return CASS_OK;
 }
 
-CassError PolygonIterator::reset_text(const char* text, size_t size) {
-  cass_uint32_t num_rings = 0;
-  const bool skip_numbers = true;
-  WktLexer lexer(text, size, skip_numbers);
-
-  if (lexer.next_token() != WktLexer::TK_TYPE_POLYGON) {
-    return CASS_ERROR_LIB_BAD_PARAMS;
+CassError PolygonIterator::envelope(cass_double_t* min_x, cass_double_t* min_y,
+                                    cass_double_t* max_x, cass_double_t* max_y) const {
+  CassError rc = check_rings();
+  if (rc != CASS_OK) return rc;
+  Envelope envelope;
+  if (rings_begin_ != NULL) {
+    envelope.expand_rings(rings_begin_, num_rings_, byte_order_);
   }
+  return envelope.get(min_x, min_y, max_x, max_y);
+}
 
-  // Validate format and count the number of rings
-  if (lexer.next_token() != WktLexer::TK_OPEN_PAREN) {
-    return CASS_ERROR_LIB_BAD_PARAMS;
-  }
+CassError PolygonIterator::reset_binary_trusted(const CassValue* value) {
+  size_t size;
+  const cass_byte_t* pos;
 
-  WktLexer::Token token = lexer.next_token();
-  while (token != WktLexer::TK_EOF && token != WktLexer::TK_CLOSE_PAREN) {
-    // Start ring
-    if (token != WktLexer::TK_OPEN_PAREN) {
-      return CASS_ERROR_LIB_BAD_PARAMS;
-    }
+  CassError rc = data_type_validator_.validate(value);
+  if (rc != CASS_OK) return rc;
 
-    // Consume points in ring
-    token = lexer.next_token();
-    while (token != WktLexer::TK_EOF && token != WktLexer::TK_CLOSE_PAREN) {
-      // First number in point
-      if (token != WktLexer::TK_NUMBER) {
-        return CASS_ERROR_LIB_BAD_PARAMS;
-      }
-
-      // Second number in point
-      token = lexer.next_token();
-      if (token != WktLexer::TK_NUMBER) {
-        return CASS_ERROR_LIB_BAD_PARAMS;
-      }
-
-      // Check and skip "," token
-      token = lexer.next_token();
-      if (token == WktLexer::TK_COMMA) {
-        token = lexer.next_token();
-        // Verify there are more points
-        if(token != WktLexer::TK_NUMBER) {
-          return CASS_ERROR_LIB_BAD_PARAMS;
-        }
-      }
-    }
+  rc = cass_value_get_bytes(value, &pos, &size);
+  if (rc != CASS_OK) return rc;
 
-    // End ring
-    if (token != WktLexer::TK_CLOSE_PAREN) {
-      return CASS_ERROR_LIB_BAD_PARAMS;
-    }
+  return reset_binary_trusted(pos, size);
+}
 
-    ++num_rings;
+CassError PolygonIterator::reset_binary_trusted(const cass_byte_t* data, size_t size) {
+#if defined(NDEBUG)
+  return reset_binary_unchecked(data, size);
+#else
+  CassError rc = reset_binary(data, size);
+  assert(rc == CASS_OK && "Trusted polygon data is invalid");
+  return rc;
+#endif
+}
 
-    // Check and skip "," token
-    token = lexer.next_token();
-    if (token == WktLexer::TK_COMMA) {
-      token = lexer.next_token();
-      // Verify there are more rings
-      if (token != WktLexer::TK_OPEN_PAREN) {
-        return CASS_ERROR_LIB_BAD_PARAMS;
-      }
-    }
+CassError PolygonIterator::reset_binary_unchecked(const cass_byte_t* data, size_t size) {
+  dse::WkbByteOrder byte_order;
+
+  num_rings_ = 0;
+  state_ = STATE_DONE;
+  rings_begin_ = NULL;
+  rings_.clear();
+
+  if (size < WKB_POLYGON_HEADER_SIZE) {
+    return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
   }
 
-  // Validate closing ")"
-  if (token != WktLexer::TK_CLOSE_PAREN) {
-    return CASS_ERROR_LIB_BAD_PARAMS;
+  if (dse::decode_header(data, &byte_order) != dse::WKB_GEOMETRY_TYPE_POLYGON) {
+    return CASS_ERROR_LIB_INVALID_DATA;
+  }
+
+  // Every ring has at least a point count
+  cass_uint32_t num_rings = dse::decode_uint32(data + WKB_HEADER_SIZE, byte_order);
+  if (num_rings > (size - WKB_POLYGON_HEADER_SIZE) / sizeof(cass_uint32_t)) {
+    return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
   }
 
   num_rings_ = num_rings;
-  text_iterator_ = TextIterator(text, size);
-  iterator_ = &text_iterator_;
+  state_ = num_rings > 0 ? STATE_NUM_POINTS : STATE_DONE;
+  rings_begin_ = data + WKB_POLYGON_HEADER_SIZE;
+  position_ = rings_begin_;
+  rings_end_ = data + size;
+  points_end_ = NULL;
+  byte_order_ = byte_order;
+  rings_checked_ = false;
 
   return CASS_OK;
 }
 
-CassError PolygonIterator::BinaryIterator::next_num_points(cass_uint32_t* num_points) {
-  if (state_ != STATE_NUM_POINTS) {
-    return CASS_ERROR_LIB_INVALID_STATE;
+CassError PolygonIterator::check_rings() const {
+  if (rings_checked_) return CASS_OK;
+  const cass_byte_t* pos = rings_begin_;
+  for (cass_uint32_t i = 0; i < num_rings_; ++i) {
+    size_t available = rings_end_ - pos;
+    if (available < sizeof(cass_uint32_t)) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+    available -= sizeof(cass_uint32_t);
+    cass_uint32_t num_points = decode_uint32(pos, byte_order_);
+    if (num_points > available / (2 * sizeof(cass_double_t))) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+    pos += sizeof(cass_uint32_t) + 2 * num_points * sizeof(cass_double_t);
   }
-
-  uint32_t n = *num_points = decode_uint32(position_, byte_order_);
-  position_ += sizeof(cass_uint32_t);
-  points_end_ = position_ + n * 2 * sizeof(cass_double_t);
-  state_ = STATE_POINTS;
-
+  rings_checked_ = true;
   return CASS_OK;
 }
 
-CassError PolygonIterator::BinaryIterator::next_point(cass_double_t* x, cass_double_t* y) {
-  if (state_ != STATE_POINTS) {
-    return CASS_ERROR_LIB_INVALID_STATE;
-  }
-
-  *x = decode_double(position_, byte_order_);
-  position_ += sizeof(cass_double_t);
-  *y = decode_double(position_, byte_order_);
-  position_ += sizeof(cass_double_t);
-  if (position_ >= rings_end_) {
-    state_ = STATE_DONE;
-  } else if (position_ >= points_end_) {
-    state_ = STATE_NUM_POINTS;
+CassError PolygonIterator::index_rings() const {
+  if (rings_.size() == num_rings_) return CASS_OK;
+  CassError rc = check_rings();
+  if (rc != CASS_OK) return rc;
+  rings_.reserve(num_rings_);
+  const cass_byte_t* pos = rings_begin_;
+  for (cass_uint32_t i = 0; i < num_rings_; ++i) {
+    rings_.push_back(pos);
+    pos += sizeof(cass_uint32_t) +
+           2 * decode_uint32(pos, byte_order_) * sizeof(cass_double_t);
   }
-
   return CASS_OK;
 }
 
-PolygonIterator::TextIterator::TextIterator(const char* text, size_t size)
-  : state_(STATE_NUM_POINTS)
-  , lexer_(text, size) {
-  WktLexer::Token token; UNUSED_(token);
-  // Skip over "POLYGON (" tokens
-  token = lexer_.next_token(); assert(token == WktLexer::TK_TYPE_POLYGON);
-  token = lexer_.next_token(); assert(token == WktLexer::TK_OPEN_PAREN);
-}
-
-CassError PolygonIterator::TextIterator::next_num_points(cass_uint32_t* num_points) {
-  WktLexer::Token token;
-  token = lexer_.next_token();
-
-  *num_points = 0;
-
-  // If we're at the end of the text this will return WktLexer::TK_EOF
-  if (state_ != STATE_NUM_POINTS || token != WktLexer::TK_OPEN_PAREN) {
+CassError PolygonIterator::contains_point(cass_double_t x, cass_double_t y,
+                                          cass_bool_t* contains) const {
+  if (rings_begin_ == NULL) {
     return CASS_ERROR_LIB_INVALID_STATE;
   }
-
-  const bool skip_numbers = true;
-  WktLexer temp(lexer_, skip_numbers); // Read forward using a temp lexer
-
-  token = temp.next_token();
-  while (token != WktLexer::TK_EOF && token != WktLexer::TK_CLOSE_PAREN) {
-    // First number in point
-    assert(token == WktLexer::TK_NUMBER);
-
-    // Second number in point
-    token = temp.next_token(); assert(token == WktLexer::TK_NUMBER);
-
-    ++(*num_points);
-
-    // Check and skip "," token
-    token = temp.next_token();
-    if (token == WktLexer::TK_COMMA) {
-      token = temp.next_token();
-      assert(token == WktLexer::TK_NUMBER);
-    }
-  }
-
-  assert(token == WktLexer::TK_CLOSE_PAREN);
-  state_ = STATE_POINTS;
-
+  CassError rc = check_rings();
+  if (rc != CASS_OK) return rc;
+  *contains = rings_contain_point(rings_begin_, num_rings_, byte_order_, x, y)
+              ? cass_true : cass_false;
   return CASS_OK;
 }
 
-CassError PolygonIterator::TextIterator::next_point(cass_double_t* x, cass_double_t* y) {
-  WktLexer::Token token;
-
-  if (state_ != STATE_POINTS) {
+CassError PolygonIterator::intersects_box(cass_double_t min_x, cass_double_t min_y,
+                                          cass_double_t max_x, cass_double_t max_y,
+                                          cass_bool_t* intersects) const {
+  if (!(min_x <= max_x && min_y <= max_y)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  if (rings_begin_ == NULL) {
     return CASS_ERROR_LIB_INVALID_STATE;
   }
+  CassError rc = check_rings();
+  if (rc != CASS_OK) return rc;
+  *intersects = rings_intersect_box(rings_begin_, num_rings_, byte_order_,
+                                    min_x, min_y, max_x, max_y)
+                ? cass_true : cass_false;
+  return CASS_OK;
+}
 
-  // First number in point
-  token = lexer_.next_token(); assert(token == WktLexer::TK_NUMBER);
-  *x = lexer_.number();
-
-  // Second number in point
-  token = lexer_.next_token(); assert(token == WktLexer::TK_NUMBER);
-  *y = lexer_.number();
-
-  token = lexer_.next_token();
-  if (token == WktLexer::TK_CLOSE_PAREN) {
-     // Done with this ring
-    token = lexer_.next_token();
-    if (token == WktLexer::TK_CLOSE_PAREN) {
-      // Done with last ring
-      state_ = STATE_DONE;
-    } else {
-      // More rings
-      assert(token == WktLexer::TK_COMMA);
-      state_ = STATE_NUM_POINTS;
-    }
-  } else {
-    // More points
-    assert(token == WktLexer::TK_COMMA);
-  }
+CassError PolygonIterator::reset_text(const char* text, size_t size) {
+  num_rings_ = 0;
+  state_ = STATE_DONE;
+  rings_begin_ = NULL;
+  rings_.clear();
+  text_bytes_.clear();
+
+  // Validate, count and decode the rings in a single pass
+  CassError rc = WktParser(text, size).parse(WKB_GEOMETRY_TYPE_POLYGON, text_bytes_);
+  if (rc != CASS_OK) return rc;
 
-  return CASS_OK;
+  return reset_binary(text_bytes_.data(), text_bytes_.size());
 }
 
 } // namespace dse
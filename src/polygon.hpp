@@ -10,12 +10,15 @@
 
 #include "dse.h"
 
+#include "envelope.hpp"
 #include "serialization.hpp"
-#include "wkt.hpp"
+#include "validate.hpp"
+#include "wkt_writer.hpp"
 
 #include <external.hpp>
 
 #include <string>
+#include <vector>
 
 namespace dse {
 
@@ -28,6 +31,7 @@ public:
   const Bytes& bytes() const { return bytes_; }
 
   void reset() {
+    envelope_.reset();
     num_rings_ = 0;
     num_points_ = 0;
     ring_start_index_ = 0;
@@ -59,9 +63,33 @@ public:
   void add_point(cass_double_t x, cass_double_t y) {
     encode_append(x, bytes_);
     encode_append(y, bytes_);
+    envelope_.expand(x, y);
     num_points_++;
   }
 
+  CassError add_points(const cass_double_t* points, size_t num_points) {
+    if (num_points > std::numeric_limits<cass_uint32_t>::max() - num_points_) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+    size_t index = bytes_.size();
+    encode_points_append(points, num_points, bytes_);
+    expand_envelope(index, num_points);
+    num_points_ += static_cast<cass_uint32_t>(num_points);
+    return CASS_OK;
+  }
+
+  CassError add_points(const cass_double_t* x, const cass_double_t* y,
+                       size_t num_points) {
+    if (num_points > std::numeric_limits<cass_uint32_t>::max() - num_points_) {
+      return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+    size_t index = bytes_.size();
+    encode_points_append(x, y, num_points, bytes_);
+    expand_envelope(index, num_points);
+    num_points_ += static_cast<cass_uint32_t>(num_points);
+    return CASS_OK;
+  }
+
   CassError finish() {
     if (num_rings_ == 0) {
       return CASS_ERROR_LIB_INVALID_STATE;
@@ -70,8 +98,37 @@ public:
     return finish_ring(); // Finish the last ring
   }
 
+  CassError from_wkt(const char* text, size_t size);
+
+  CassError envelope(cass_double_t* min_x, cass_double_t* min_y,
+                     cass_double_t* max_x, cass_double_t* max_y) const {
+    return envelope_.get(min_x, min_y, max_x, max_y);
+  }
+
+  CassError simplify(cass_double_t tolerance);
+
+  CassError contains_point(cass_double_t x, cass_double_t y,
+                           cass_bool_t* contains) const;
+  CassError intersects_box(cass_double_t min_x, cass_double_t min_y,
+                           cass_double_t max_x, cass_double_t max_y,
+                           cass_bool_t* intersects) const;
+
   std::string to_wkt() const;
 
+  template <class Buffer>
+  void to_wkt(WktWriter<Buffer>& writer) const {
+    writer.write_tag(WKB_GEOMETRY_TYPE_POLYGON);
+    writer.write_rings(bytes_.data() + WKB_POLYGON_HEADER_SIZE,
+                       num_rings_, native_byte_order());
+  }
+
+private:
+  void expand_envelope(size_t index, size_t num_points) {
+    if (num_points > 0) {
+      envelope_.expand(&bytes_[index], num_points, native_byte_order());
+    }
+  }
+
 private:
   CassError finish_ring() {
     if (ring_start_index_ > 0) {
@@ -89,6 +146,7 @@ private:
   cass_uint32_t num_rings_;
   cass_uint32_t num_points_;
   size_t ring_start_index_;
+  Envelope envelope_;
   Bytes bytes_;
 };
 
@@ -102,75 +160,171 @@ private:
 
 public:
   PolygonIterator()
-    : num_rings_(0)
-    , iterator_(NULL) { }
+    : data_type_validator_(DSE_POLYGON_TYPE)
+    , num_rings_(0)
+    , state_(STATE_DONE)
+    , rings_begin_(NULL)
+    , position_(NULL)
+    , rings_end_(NULL)
+    , points_end_(NULL)
+    , byte_order_(WKB_BYTE_ORDER_LITTLE_ENDIAN)
+    , rings_checked_(false) { }
 
   cass_uint32_t num_rings() const { return num_rings_; }
 
   CassError reset_binary(const CassValue* value);
+  CassError reset_binary(const cass_byte_t* data, size_t size);
   CassError reset_text(const char* text, size_t size);
 
-   CassError next_num_points(cass_uint32_t* num_points) {
-     if (iterator_ == NULL) {
-       return CASS_ERROR_LIB_INVALID_STATE;
-     }
-     return iterator_->next_num_points(num_points);
+  // Only the header is checked in release builds. Debug builds validate the
+  // rings the same as reset_binary().
+  CassError reset_binary_trusted(const CassValue* value);
+  CassError reset_binary_trusted(const cass_byte_t* data, size_t size);
+
+  // Only checks the header so it takes constant time. The data must end
+  // with the last ring. The rings are checked against the end of the data as
+  // they're iterated, or all at once the first time they're needed as a
+  // whole, e.g. for seeking or the spatial predicates.
+  CassError reset_binary_unchecked(const cass_byte_t* data, size_t size);
+
+  // Computed from all the rings regardless of the iterator's position
+  CassError envelope(cass_double_t* min_x, cass_double_t* min_y,
+                     cass_double_t* max_x, cass_double_t* max_y) const;
+
+  // Moves to the start of a ring so that the next call is to
+  // next_num_points()
+  CassError seek_ring(cass_uint32_t index) {
+    if (index >= num_rings_) {
+      return CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS;
+    }
+    CassError rc = index_rings();
+    if (rc != CASS_OK) return rc;
+    state_ = STATE_NUM_POINTS;
+    position_ = rings_[index];
+    return CASS_OK;
+  }
+
+  CassError ring_num_points(cass_uint32_t index, cass_uint32_t* num_points) const {
+    if (index >= num_rings_) {
+      return CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS;
+    }
+    CassError rc = index_rings();
+    if (rc != CASS_OK) return rc;
+    *num_points = decode_uint32(rings_[index], byte_order_);
+    return CASS_OK;
+  }
+
+  // Tested against all the rings regardless of the iterator's position
+  CassError contains_point(cass_double_t x, cass_double_t y,
+                           cass_bool_t* contains) const;
+  CassError intersects_box(cass_double_t min_x, cass_double_t min_y,
+                           cass_double_t max_x, cass_double_t max_y,
+                           cass_bool_t* intersects) const;
+
+  CassError next_num_points(cass_uint32_t* num_points) {
+    if (state_ != STATE_NUM_POINTS) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+
+    // Rings from unchecked resets can run past the end of the data
+    size_t available = rings_end_ - position_;
+    if (available < sizeof(cass_uint32_t)) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+    cass_uint32_t n = decode_uint32(position_, byte_order_);
+    if (n > (available - sizeof(cass_uint32_t)) / (2 * sizeof(cass_double_t))) {
+      return CASS_ERROR_LIB_NOT_ENOUGH_DATA;
+    }
+
+    *num_points = n;
+    position_ += sizeof(cass_uint32_t);
+    points_end_ = position_ + n * 2 * sizeof(cass_double_t);
+    if (n > 0) {
+      state_ = STATE_POINTS;
+    } else {
+      finish_ring(); // Empty ring
+    }
+
+    return CASS_OK;
   }
 
   CassError next_point(cass_double_t* x, cass_double_t* y) {
-     if (iterator_ == NULL) {
-       return CASS_ERROR_LIB_INVALID_STATE;
-     }
-     return iterator_->next_point(x, y);
+    if (state_ != STATE_POINTS) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+
+    *x = decode_double(position_, byte_order_);
+    position_ += sizeof(cass_double_t);
+    *y = decode_double(position_, byte_order_);
+    position_ += sizeof(cass_double_t);
+    if (position_ >= rings_end_) {
+      state_ = STATE_DONE;
+    } else if (position_ >= points_end_) {
+      state_ = STATE_NUM_POINTS;
+    }
+
+    return CASS_OK;
   }
 
-private:
-  class Iterator {
-  public:
-    virtual CassError next_num_points(cass_uint32_t* num_points) = 0;
-    virtual CassError next_point(cass_double_t* x, cass_double_t* y) = 0;
-  };
+  CassError next_points(const cass_byte_t** points, cass_uint32_t* num_points) {
+    if (state_ != STATE_POINTS) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
 
-  class BinaryIterator : public Iterator {
-  public:
-    BinaryIterator() { }
-    BinaryIterator(const cass_byte_t* rings_begin,
-                   const cass_byte_t* rings_end,
-                   WkbByteOrder byte_order)
-      : state_(STATE_NUM_POINTS)
-      , position_(rings_begin)
-      , rings_end_(rings_end)
-      , points_end_(NULL)
-      , byte_order_(byte_order) { }
-
-    virtual CassError next_num_points(cass_uint32_t* num_points);
-    virtual CassError next_point(cass_double_t* x, cass_double_t* y);
-
-  private:
-    State state_;
-    const cass_byte_t* position_;
-    const cass_byte_t* rings_end_;
-    const cass_byte_t* points_end_;
-    WkbByteOrder byte_order_;
-  };
+    // Swapped coordinates can only be copied
+    if (byte_order_ != native_byte_order()) {
+      return CASS_ERROR_LIB_NOT_IMPLEMENTED;
+    }
 
-  class TextIterator : public Iterator {
-  public:
-    TextIterator() { }
-    TextIterator(const char* text, size_t size);
+    *points = position_;
+    *num_points = remaining();
+    finish_ring();
 
-    virtual CassError next_num_points(cass_uint32_t* num_points);
-    virtual CassError next_point(cass_double_t* x, cass_double_t* y);
+    return CASS_OK;
+  }
 
-  private:
-    State state_;
-    WktLexer lexer_;
-  };
+  CassError next_points_copy(cass_double_t* output, cass_uint32_t* num_points) {
+    if (state_ != STATE_POINTS) {
+      return CASS_ERROR_LIB_INVALID_STATE;
+    }
+
+    *num_points = remaining();
+    decode_doubles(position_, 2 * *num_points, byte_order_, output);
+    finish_ring();
+
+    return CASS_OK;
+  }
 
+private:
+  // Checks that the rings fit in the data. This only walks the rings the
+  // first time after an unchecked reset.
+  CassError check_rings() const;
+
+  // The ring index is only built when it's first needed so that sequential
+  // iteration doesn't allocate
+  CassError index_rings() const;
+
+  void finish_ring() {
+    position_ = points_end_;
+    state_ = position_ >= rings_end_ ? STATE_DONE : STATE_NUM_POINTS;
+  }
+
+  cass_uint32_t remaining() const {
+    return static_cast<cass_uint32_t>((points_end_ - position_) / (2 * sizeof(cass_double_t)));
+  }
+
+private:
+  DataTypeValidator data_type_validator_;
   cass_uint32_t num_rings_;
-  Iterator* iterator_;
-  BinaryIterator binary_iterator_;
-  TextIterator text_iterator_;
+  State state_;
+  const cass_byte_t* rings_begin_;
+  const cass_byte_t* position_;
+  const cass_byte_t* rings_end_;
+  const cass_byte_t* points_end_;
+  WkbByteOrder byte_order_;
+  mutable bool rings_checked_;
+  mutable std::vector<const cass_byte_t*> rings_; // The start of each ring for seeking
+  Bytes text_bytes_; // WKT converted to WKB so that it's only parsed once
 };
 
 } // namespace dse
@@ -15,15 +15,31 @@
 #include <assert.h>
 #include <stdint.h>
 #include <string.h>
+#include <limits>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define DSE_USE_SSE2
+#  include <emmintrin.h>
+#endif
+
 #define DSE_POINT_TYPE       "org.apache.cassandra.db.marshal.PointType"
 #define DSE_LINE_STRING_TYPE "org.apache.cassandra.db.marshal.LineStringType"
 #define DSE_POLYGON_TYPE     "org.apache.cassandra.db.marshal.PolygonType"
 
+// DSE doesn't provide marshal classes for the multi geometry types so they
+// can't be bound to statements. They're used for WKB, WKT and graph values.
+#define DSE_MULTI_POINT_TYPE         "org.apache.cassandra.db.marshal.MultiPointType"
+#define DSE_MULTI_LINE_STRING_TYPE   "org.apache.cassandra.db.marshal.MultiLineStringType"
+#define DSE_MULTI_POLYGON_TYPE       "org.apache.cassandra.db.marshal.MultiPolygonType"
+#define DSE_GEOMETRY_COLLECTION_TYPE "org.apache.cassandra.db.marshal.GeometryCollectionType"
+
 #define WKB_HEADER_SIZE (sizeof(cass_uint8_t) + sizeof(cass_uint32_t)) // Endian + Type
 #define WKB_POLYGON_HEADER_SIZE (WKB_HEADER_SIZE + sizeof(cass_uint32_t)) // Header + Num rings
 #define WKB_LINE_STRING_HEADER_SIZE (WKB_HEADER_SIZE + sizeof(cass_uint32_t)) // Header + Num points
+#define WKB_MULTI_HEADER_SIZE (WKB_HEADER_SIZE + sizeof(cass_uint32_t)) // Header + Num geometries
+#define WKB_POINT_SIZE (WKB_HEADER_SIZE + 2 * sizeof(cass_double_t)) // Header + X + Y
 
 namespace dse {
 
@@ -107,9 +123,44 @@ inline void encode(T value, size_t index, Bytes& bytes) {
 
 template<class T>
 inline void encode_append(T value, Bytes& bytes) {
-  cass_uint8_t* data = reinterpret_cast<cass_uint8_t*>(&value);
-  for (size_t i = 0; i < sizeof(T); ++i) {
-    bytes.push_back(data[i]);
+  size_t index = bytes.size();
+  bytes.resize(index + sizeof(T));
+  memcpy(&bytes[index], &value, sizeof(T));
+}
+
+// Geometries are always encoded using the native byte order so interleaved
+// points can be copied directly into the WKB buffer.
+inline void encode_points_append(const cass_double_t* points, size_t num_points,
+                                 Bytes& bytes) {
+  if (num_points == 0) return;
+  size_t size = 2 * num_points * sizeof(cass_double_t);
+  size_t index = bytes.size();
+  bytes.resize(index + size);
+  memcpy(&bytes[index], points, size);
+}
+
+inline void encode_points_append(const cass_double_t* x, const cass_double_t* y,
+                                 size_t num_points, Bytes& bytes) {
+  if (num_points == 0) return;
+  size_t index = bytes.size();
+  bytes.resize(index + 2 * num_points * sizeof(cass_double_t));
+  cass_byte_t* pos = &bytes[index];
+  size_t i = 0;
+#if defined(DSE_USE_SSE2)
+  for (; i + 2 <= num_points; i += 2) {
+    __m128d xs = _mm_loadu_pd(x + i);
+    __m128d ys = _mm_loadu_pd(y + i);
+    _mm_storeu_pd(reinterpret_cast<double*>(pos), _mm_unpacklo_pd(xs, ys));
+    _mm_storeu_pd(reinterpret_cast<double*>(pos + 2 * sizeof(cass_double_t)),
+                  _mm_unpackhi_pd(xs, ys));
+    pos += 4 * sizeof(cass_double_t);
+  }
+#endif
+  for (; i < num_points; ++i) {
+    memcpy(pos, x + i, sizeof(cass_double_t));
+    pos += sizeof(cass_double_t);
+    memcpy(pos, y + i, sizeof(cass_double_t));
+    pos += sizeof(cass_double_t);
   }
 }
 
@@ -125,7 +176,7 @@ inline cass_double_t decode_double(const cass_byte_t* bytes,
   if (byte_order != native_byte_order()) {
     cass_uint64_t temp;
     memcpy(&temp, bytes, sizeof(cass_uint64_t));
-    swap_uint64(temp);
+    temp = swap_uint64(temp);
     memcpy(&value, &temp, sizeof(cass_uint64_t));
   } else {
     memcpy(&value, bytes, sizeof(cass_uint64_t));
@@ -138,16 +189,116 @@ inline cass_uint32_t decode_uint32(const cass_byte_t* bytes,
   cass_uint32_t value;
   memcpy(&value, bytes, sizeof(cass_uint32_t));
   if (byte_order != native_byte_order()) {
-    swap_uint32(value);
+    value = swap_uint32(value);
   }
   return value;
 }
 
+inline void decode_doubles(const cass_byte_t* bytes, size_t count,
+                           WkbByteOrder byte_order,
+                           cass_double_t* output) {
+  if (count == 0) return;
+
+  if (byte_order == native_byte_order()) {
+    memcpy(output, bytes, count * sizeof(cass_double_t));
+    return;
+  }
+
+  size_t i = 0;
+#if defined(DSE_USE_SSE2)
+  for (; i + 2 <= count; i += 2) {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    // Swap the bytes of each 16-bit word then reverse the words of each double
+    value = _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+    value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+    value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), value);
+    bytes += 2 * sizeof(cass_double_t);
+  }
+#endif
+  for (; i < count; ++i) {
+    output[i] = decode_double(bytes, byte_order);
+    bytes += sizeof(cass_double_t);
+  }
+}
+
+// Splits a block of WKB coordinates into separate arrays of x and y
+// coordinates
+inline void decode_points_xy(const cass_byte_t* bytes, size_t num_points,
+                             WkbByteOrder byte_order,
+                             cass_double_t* x, cass_double_t* y) {
+  size_t i = 0;
+  if (byte_order == native_byte_order()) {
+#if defined(DSE_USE_SSE2)
+    for (; i + 2 <= num_points; i += 2) {
+      __m128d first = _mm_loadu_pd(reinterpret_cast<const double*>(bytes));
+      __m128d second = _mm_loadu_pd(reinterpret_cast<const double*>(bytes + 2 * sizeof(cass_double_t)));
+      _mm_storeu_pd(x + i, _mm_unpacklo_pd(first, second));
+      _mm_storeu_pd(y + i, _mm_unpackhi_pd(first, second));
+      bytes += 4 * sizeof(cass_double_t);
+    }
+#endif
+    for (; i < num_points; ++i) {
+      memcpy(x + i, bytes, sizeof(cass_double_t));
+      memcpy(y + i, bytes + sizeof(cass_double_t), sizeof(cass_double_t));
+      bytes += 2 * sizeof(cass_double_t);
+    }
+    return;
+  }
+
+  for (; i < num_points; ++i) {
+    x[i] = decode_double(bytes, byte_order);
+    y[i] = decode_double(bytes + sizeof(cass_double_t), byte_order);
+    bytes += 2 * sizeof(cass_double_t);
+  }
+}
+
 inline dse::WkbGeometryType decode_header(const cass_byte_t* bytes, dse::WkbByteOrder* byte_order) {
   *byte_order = static_cast<dse::WkbByteOrder>(bytes[0]);
   return static_cast<dse::WkbGeometryType>(dse::decode_uint32(bytes + 1, *byte_order));
 }
 
+// Determines the size of the point, line string or polygon at the start of the
+// buffer. Returns false if the geometry is truncated or of another type.
+inline bool decode_geometry_size(const cass_byte_t* bytes, size_t size,
+                                 size_t* geometry_size) {
+  if (size < WKB_HEADER_SIZE) return false;
+
+  WkbByteOrder byte_order;
+  WkbGeometryType type = decode_header(bytes, &byte_order);
+  size_t pos = WKB_HEADER_SIZE;
+
+  cass_uint32_t num_rings = 1;
+  switch (type) {
+    case WKB_GEOMETRY_TYPE_POINT:
+      pos += 2 * sizeof(cass_double_t);
+      num_rings = 0;
+      break;
+    case WKB_GEOMETRY_TYPE_LINESTRING:
+      break;
+    case WKB_GEOMETRY_TYPE_POLYGON:
+      if (size - pos < sizeof(cass_uint32_t)) return false;
+      num_rings = decode_uint32(bytes + pos, byte_order);
+      pos += sizeof(cass_uint32_t);
+      break;
+    default:
+      return false;
+  }
+
+  // A line string is encoded the same way as a single polygon ring
+  for (cass_uint32_t i = 0; i < num_rings; ++i) {
+    if (size - pos < sizeof(cass_uint32_t)) return false;
+    cass_uint32_t num_points = decode_uint32(bytes + pos, byte_order);
+    pos += sizeof(cass_uint32_t);
+    if ((size - pos) / (2 * sizeof(cass_double_t)) < num_points) return false;
+    pos += 2 * num_points * sizeof(cass_double_t);
+  }
+
+  if (size < pos) return false;
+  *geometry_size = pos;
+  return true;
+}
+
 } // namespace dse
 
 #endif
@@ -0,0 +1,99 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "simplify.hpp"
+
+namespace {
+
+const size_t kPointSize = 2 * sizeof(cass_double_t);
+
+inline void load_point(const cass_byte_t* points, size_t index,
+                       cass_double_t* x, cass_double_t* y) {
+  const cass_byte_t* pos = points + index * kPointSize;
+  memcpy(x, pos, sizeof(cass_double_t));
+  memcpy(y, pos + sizeof(cass_double_t), sizeof(cass_double_t));
+}
+
+} // namespace
+
+namespace dse {
+
+size_t Simplifier::mark(const cass_byte_t* points, size_t num_points,
+                        cass_double_t tolerance) {
+  if (num_points <= 2) {
+    keep_.assign(num_points, 1);
+    return num_points;
+  }
+
+  keep_.assign(num_points, 0);
+  keep_[0] = keep_[num_points - 1] = 1;
+  size_t num_kept = 2;
+
+  // An explicit stack is used so that long traces can't overflow the call
+  // stack
+  const cass_double_t tolerance_squared = tolerance * tolerance;
+  ranges_.clear();
+  ranges_.push_back(Range(0, num_points - 1));
+
+  while (!ranges_.empty()) {
+    Range range = ranges_.back();
+    ranges_.pop_back();
+    if (range.second - range.first < 2) continue;
+
+    cass_double_t ax, ay, bx, by;
+    load_point(points, range.first, &ax, &ay);
+    load_point(points, range.second, &bx, &by);
+    cass_double_t dx = bx - ax, dy = by - ay;
+    cass_double_t length_squared = dx * dx + dy * dy;
+
+    // Find the point that's farthest from the segment between the ends of
+    // the range
+    cass_double_t max_distance_squared = 0.0;
+    size_t farthest = range.first;
+    for (size_t i = range.first + 1; i < range.second; ++i) {
+      cass_double_t px, py;
+      load_point(points, i, &px, &py);
+      cass_double_t cx = ax, cy = ay; // Closest point on the segment
+      if (length_squared > 0.0) {
+        cass_double_t t = ((px - ax) * dx + (py - ay) * dy) / length_squared;
+        if (t >= 1.0) {
+          cx = bx; cy = by;
+        } else if (t > 0.0) {
+          cx = ax + t * dx; cy = ay + t * dy;
+        }
+      }
+      cass_double_t distance_squared = (px - cx) * (px - cx) + (py - cy) * (py - cy);
+      if (distance_squared > max_distance_squared) {
+        max_distance_squared = distance_squared;
+        farthest = i;
+      }
+    }
+
+    if (max_distance_squared > tolerance_squared) {
+      keep_[farthest] = 1;
+      ++num_kept;
+      ranges_.push_back(Range(range.first, farthest));
+      ranges_.push_back(Range(farthest, range.second));
+    }
+  }
+
+  return num_kept;
+}
+
+cass_byte_t* Simplifier::compact(const cass_byte_t* points, size_t num_points,
+                                 cass_byte_t* output) const {
+  for (size_t i = 0; i < num_points; ++i) {
+    if (keep_[i]) {
+      const cass_byte_t* pos = points + i * kPointSize;
+      if (pos != output) memmove(output, pos, kPointSize);
+      output += kPointSize;
+    }
+  }
+  return output;
+}
+
+} // namespace dse
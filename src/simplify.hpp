@@ -0,0 +1,43 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_SIMPLIFY_HPP_INCLUDED__
+#define __DSE_SIMPLIFY_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace dse {
+
+// Simplifies blocks of native byte order WKB coordinates in place using the
+// Douglas-Peucker algorithm. The first and last points are always kept and
+// every removed point is within the tolerance of the simplified line.
+class Simplifier {
+public:
+  // Determines which points to keep. Returns the number of points kept.
+  size_t mark(const cass_byte_t* points, size_t num_points,
+              cass_double_t tolerance);
+
+  // Moves the points that were kept to the output, which can be the same as
+  // or before the points. Returns the end of the output.
+  cass_byte_t* compact(const cass_byte_t* points, size_t num_points,
+                       cass_byte_t* output) const;
+
+private:
+  typedef std::pair<size_t, size_t> Range;
+
+  std::vector<char> keep_;
+  std::vector<Range> ranges_;
+};
+
+} // namespace dse
+
+#endif
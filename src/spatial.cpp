@@ -0,0 +1,218 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "spatial.hpp"
+
+#include <math.h>
+
+extern "C" {
+
+cass_double_t dse_haversine_distance(cass_double_t x1, cass_double_t y1,
+                                     cass_double_t x2, cass_double_t y2) {
+  return dse::haversine_distance(x1, y1, x2, y2);
+}
+
+void dse_haversine_distance_n(cass_double_t x, cass_double_t y,
+                              const cass_double_t* xs, const cass_double_t* ys,
+                              size_t num_points,
+                              cass_double_t* distances) {
+  dse::haversine_distances(x, y, xs, ys, num_points, distances);
+}
+
+} // extern "C"
+
+namespace {
+
+const cass_double_t kDegreesToRadians = 0.017453292519943295;
+
+// Determines if a ray cast from (x, y) in the direction of positive x crosses
+// the edge from (xi, yi) to (xj, yj). Horizontal edges never cross because
+// they can't straddle the ray.
+inline bool crosses(cass_double_t xi, cass_double_t yi,
+                    cass_double_t xj, cass_double_t yj,
+                    cass_double_t x, cass_double_t y) {
+  return ((yi > y) != (yj > y)) &&
+      x < (xj - xi) * (y - yi) / (yj - yi) + xi;
+}
+
+// Counts the edges of a ring that are crossed by a ray cast from (x, y). The
+// ring is implicitly closed so rings that don't repeat their first point are
+// handled the same as rings that do.
+cass_uint32_t count_crossings(const cass_byte_t* points, cass_uint32_t num_points,
+                              dse::WkbByteOrder byte_order,
+                              cass_double_t x, cass_double_t y) {
+  if (num_points == 0) return 0;
+
+  cass_uint32_t count = 0;
+  cass_uint32_t i = 0;
+
+#if defined(DSE_USE_SSE2)
+  if (byte_order == dse::native_byte_order()) {
+    // Two edges are tested at a time by splitting three consecutive points
+    // into the x and y coordinates of the edges' start and end points
+    const __m128d px = _mm_set1_pd(x);
+    const __m128d py = _mm_set1_pd(y);
+    const cass_byte_t* pos = points;
+    __m128d first = _mm_loadu_pd(reinterpret_cast<const double*>(pos));
+    for (; i + 2 < num_points; i += 2) {
+      __m128d second = _mm_loadu_pd(reinterpret_cast<const double*>(pos + 2 * sizeof(cass_double_t)));
+      __m128d third = _mm_loadu_pd(reinterpret_cast<const double*>(pos + 4 * sizeof(cass_double_t)));
+      __m128d xi = _mm_unpacklo_pd(first, second);
+      __m128d yi = _mm_unpackhi_pd(first, second);
+      __m128d xj = _mm_unpacklo_pd(second, third);
+      __m128d yj = _mm_unpackhi_pd(second, third);
+
+      // Lanes that don't straddle the ray can divide by zero, but they're
+      // masked out
+      __m128d straddles = _mm_xor_pd(_mm_cmpgt_pd(yi, py), _mm_cmpgt_pd(yj, py));
+      __m128d intersection = _mm_add_pd(_mm_div_pd(_mm_mul_pd(_mm_sub_pd(xj, xi),
+                                                              _mm_sub_pd(py, yi)),
+                                                   _mm_sub_pd(yj, yi)),
+                                        xi);
+      int mask = _mm_movemask_pd(_mm_and_pd(straddles, _mm_cmplt_pd(px, intersection)));
+      count += (mask & 1) + (mask >> 1);
+
+      first = third;
+      pos += 4 * sizeof(cass_double_t);
+    }
+  }
+#endif
+
+  const cass_byte_t* pos = points + i * 2 * sizeof(cass_double_t);
+  cass_double_t xi = dse::decode_double(pos, byte_order);
+  cass_double_t yi = dse::decode_double(pos + sizeof(cass_double_t), byte_order);
+  for (++i; i < num_points; ++i) {
+    pos += 2 * sizeof(cass_double_t);
+    cass_double_t xj = dse::decode_double(pos, byte_order);
+    cass_double_t yj = dse::decode_double(pos + sizeof(cass_double_t), byte_order);
+    if (crosses(xi, yi, xj, yj, x, y)) ++count;
+    xi = xj;
+    yi = yj;
+  }
+
+  // Closing edge from the last point to the first point
+  cass_double_t x0 = dse::decode_double(points, byte_order);
+  cass_double_t y0 = dse::decode_double(points + sizeof(cass_double_t), byte_order);
+  if (crosses(xi, yi, x0, y0, x, y)) ++count;
+
+  return count;
+}
+
+// Narrows the range [t0, t1] of the parametric segment to the part inside of
+// a single boundary of the box (Liang-Barsky). Returns false if nothing is
+// left.
+inline bool clip(cass_double_t p, cass_double_t q,
+                 cass_double_t* t0, cass_double_t* t1) {
+  if (p == 0.0) return q >= 0.0; // Parallel to the boundary
+  cass_double_t r = q / p;
+  if (p < 0.0) {
+    if (r > *t1) return false;
+    if (r > *t0) *t0 = r;
+  } else {
+    if (r < *t0) return false;
+    if (r < *t1) *t1 = r;
+  }
+  return true;
+}
+
+inline bool segment_intersects_box(cass_double_t x0, cass_double_t y0,
+                                   cass_double_t x1, cass_double_t y1,
+                                   cass_double_t min_x, cass_double_t min_y,
+                                   cass_double_t max_x, cass_double_t max_y) {
+  // Segments with both ends past the same side of the box are rejected
+  // without clipping
+  if ((x0 < min_x && x1 < min_x) || (x0 > max_x && x1 > max_x) ||
+      (y0 < min_y && y1 < min_y) || (y0 > max_y && y1 > max_y)) {
+    return false;
+  }
+  cass_double_t t0 = 0.0, t1 = 1.0;
+  cass_double_t dx = x1 - x0, dy = y1 - y0;
+  return clip(-dx, x0 - min_x, &t0, &t1) &&
+      clip(dx, max_x - x0, &t0, &t1) &&
+      clip(-dy, y0 - min_y, &t0, &t1) &&
+      clip(dy, max_y - y0, &t0, &t1);
+}
+
+} // namespace
+
+namespace dse {
+
+bool rings_contain_point(const cass_byte_t* rings, cass_uint32_t num_rings,
+                         WkbByteOrder byte_order,
+                         cass_double_t x, cass_double_t y) {
+  cass_uint32_t count = 0;
+  for (cass_uint32_t i = 0; i < num_rings; ++i) {
+    cass_uint32_t num_points = decode_uint32(rings, byte_order);
+    rings += sizeof(cass_uint32_t);
+    count += count_crossings(rings, num_points, byte_order, x, y);
+    rings += 2 * num_points * sizeof(cass_double_t);
+  }
+  return (count & 1) != 0;
+}
+
+bool rings_intersect_box(const cass_byte_t* rings, cass_uint32_t num_rings,
+                         WkbByteOrder byte_order,
+                         cass_double_t min_x, cass_double_t min_y,
+                         cass_double_t max_x, cass_double_t max_y) {
+  // Either an edge (or a vertex) of the polygon is inside the box or the
+  // box is completely inside or outside of the polygon. In the latter case
+  // any corner of the box decides so its crossings are counted in the same
+  // pass.
+  cass_uint32_t count = 0;
+  const cass_byte_t* pos = rings;
+  for (cass_uint32_t i = 0; i < num_rings; ++i) {
+    cass_uint32_t num_points = decode_uint32(pos, byte_order);
+    pos += sizeof(cass_uint32_t);
+    if (num_points == 0) continue;
+
+    const cass_byte_t* first = pos;
+    cass_double_t xi = decode_double(pos, byte_order);
+    cass_double_t yi = decode_double(pos + sizeof(cass_double_t), byte_order);
+    for (cass_uint32_t j = 0; j < num_points; ++j) {
+      // The last edge closes the ring
+      const cass_byte_t* next = j + 1 < num_points ? pos + 2 * sizeof(cass_double_t) : first;
+      cass_double_t xj = decode_double(next, byte_order);
+      cass_double_t yj = decode_double(next + sizeof(cass_double_t), byte_order);
+      if (segment_intersects_box(xi, yi, xj, yj, min_x, min_y, max_x, max_y)) {
+        return true;
+      }
+      if (crosses(xi, yi, xj, yj, min_x, min_y)) ++count;
+      xi = xj;
+      yi = yj;
+      pos += 2 * sizeof(cass_double_t);
+    }
+  }
+  return (count & 1) != 0;
+}
+
+cass_double_t haversine_distance(cass_double_t x1, cass_double_t y1,
+                                 cass_double_t x2, cass_double_t y2) {
+  cass_double_t lat1 = y1 * kDegreesToRadians;
+  cass_double_t lat2 = y2 * kDegreesToRadians;
+  cass_double_t sin_lat = sin((lat2 - lat1) / 2.0);
+  cass_double_t sin_lon = sin((x2 - x1) * kDegreesToRadians / 2.0);
+  cass_double_t a = sin_lat * sin_lat + cos(lat1) * cos(lat2) * sin_lon * sin_lon;
+  return 2.0 * DSE_EARTH_RADIUS * asin(a < 1.0 ? sqrt(a) : 1.0);
+}
+
+void haversine_distances(cass_double_t x, cass_double_t y,
+                         const cass_double_t* xs, const cass_double_t* ys,
+                         size_t num_points,
+                         cass_double_t* distances) {
+  // The cosine of the fixed point's latitude is only computed once
+  cass_double_t lat = y * kDegreesToRadians;
+  cass_double_t cos_lat = cos(lat);
+  for (size_t i = 0; i < num_points; ++i) {
+    cass_double_t lat_i = ys[i] * kDegreesToRadians;
+    cass_double_t sin_lat = sin((lat_i - lat) / 2.0);
+    cass_double_t sin_lon = sin((xs[i] - x) * kDegreesToRadians / 2.0);
+    cass_double_t a = sin_lat * sin_lat + cos_lat * cos(lat_i) * sin_lon * sin_lon;
+    distances[i] = 2.0 * DSE_EARTH_RADIUS * asin(a < 1.0 ? sqrt(a) : 1.0);
+  }
+}
+
+} // namespace dse
@@ -0,0 +1,48 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_SPATIAL_HPP_INCLUDED__
+#define __DSE_SPATIAL_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+
+// Mean radius of the earth in meters (IUGG)
+#define DSE_EARTH_RADIUS 6371008.8
+
+namespace dse {
+
+// Spatial predicates that run directly on the rings of a WKB polygon where
+// each ring starts with its number of points. Holes are handled using the
+// even-odd rule so the rings can be tested in any order. Points that lie
+// exactly on an edge may be reported as either inside or outside.
+
+bool rings_contain_point(const cass_byte_t* rings, cass_uint32_t num_rings,
+                         WkbByteOrder byte_order,
+                         cass_double_t x, cass_double_t y);
+
+// Runs in a single pass over the points. Callers that already have the
+// polygon's envelope can use it to reject boxes without reading the points.
+bool rings_intersect_box(const cass_byte_t* rings, cass_uint32_t num_rings,
+                         WkbByteOrder byte_order,
+                         cass_double_t min_x, cass_double_t min_y,
+                         cass_double_t max_x, cass_double_t max_y);
+
+// Great-circle distance in meters between two points where x is the
+// longitude and y is the latitude in degrees
+cass_double_t haversine_distance(cass_double_t x1, cass_double_t y1,
+                                 cass_double_t x2, cass_double_t y2);
+
+void haversine_distances(cass_double_t x, cass_double_t y,
+                         const cass_double_t* xs, const cass_double_t* ys,
+                         size_t num_points,
+                         cass_double_t* distances);
+
+} // namespace dse
+
+#endif
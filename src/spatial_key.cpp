@@ -0,0 +1,221 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include "spatial_key.hpp"
+
+#include <algorithm>
+
+extern "C" {
+
+CassError dse_morton_code_n(const cass_double_t* x, const cass_double_t* y,
+                            size_t num_points,
+                            cass_double_t min_x, cass_double_t min_y,
+                            cass_double_t max_x, cass_double_t max_y,
+                            cass_uint64_t* codes) {
+  if (!(min_x < max_x && min_y < max_y)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  dse::SpatialGrid(min_x, min_y, max_x, max_y).morton_codes(x, y, num_points, codes);
+  return CASS_OK;
+}
+
+CassError dse_hilbert_index_n(const cass_double_t* x, const cass_double_t* y,
+                              size_t num_points,
+                              cass_double_t min_x, cass_double_t min_y,
+                              cass_double_t max_x, cass_double_t max_y,
+                              cass_uint64_t* indices) {
+  if (!(min_x < max_x && min_y < max_y)) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  dse::SpatialGrid(min_x, min_y, max_x, max_y).hilbert_indices(x, y, num_points, indices);
+  return CASS_OK;
+}
+
+CassError dse_geohash_n(const cass_double_t* x, const cass_double_t* y,
+                        size_t num_points,
+                        size_t precision,
+                        char* output) {
+  if (precision < 1 || precision > DSE_GEOHASH_MAX_PRECISION) {
+    return CASS_ERROR_LIB_BAD_PARAMS;
+  }
+  dse::geohashes(x, y, num_points, precision, output);
+  return CASS_OK;
+}
+
+} // extern "C"
+
+namespace {
+
+// Points are processed in chunks so that their cells fit on the stack
+const size_t kChunkSize = 256;
+
+const cass_double_t kMaxCell = 4294967295.0; // 2^32 - 1
+const cass_double_t kHighBit = 2147483648.0; // 2^31
+
+const char kGeohashAlphabet[] = "0123456789bcdefghjkmnpqrstuvwxyz";
+
+inline cass_uint32_t quantize(cass_double_t value, cass_double_t min, cass_double_t scale) {
+  cass_double_t cell = (value - min) * scale;
+  cell = cell > 0.0 ? cell : 0.0; // Also maps NaN to the first cell
+  cell = cell < kMaxCell ? cell : kMaxCell;
+  return static_cast<cass_uint32_t>(cell);
+}
+
+void quantize(const cass_double_t* values, size_t count,
+              cass_double_t min, cass_double_t scale,
+              cass_uint32_t* cells) {
+  size_t i = 0;
+#if defined(DSE_USE_SSE2)
+  const __m128d vmin = _mm_set1_pd(min);
+  const __m128d vscale = _mm_set1_pd(scale);
+  const __m128d zero = _mm_setzero_pd();
+  const __m128d max_cell = _mm_set1_pd(kMaxCell);
+  const __m128d high_bit = _mm_set1_pd(kHighBit);
+  const __m128i high_bit_mask = _mm_set1_epi32(static_cast<int>(0x80000000));
+  for (; i + 2 <= count; i += 2) {
+    __m128d cell = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(values + i), vmin), vscale);
+    cell = _mm_min_pd(_mm_max_pd(cell, zero), max_cell);
+
+    // There's only a signed conversion so the high bit is removed first and
+    // then added back to the truncated integer
+    __m128d high = _mm_cmpge_pd(cell, high_bit);
+    __m128i result = _mm_cvttpd_epi32(_mm_sub_pd(cell, _mm_and_pd(high, high_bit)));
+    high = _mm_castsi128_pd(_mm_shuffle_epi32(_mm_castpd_si128(high), _MM_SHUFFLE(3, 3, 2, 0)));
+    result = _mm_or_si128(result, _mm_and_si128(_mm_castpd_si128(high), high_bit_mask));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(cells + i), result);
+  }
+#endif
+  for (; i < count; ++i) {
+    cells[i] = quantize(values[i], min, scale);
+  }
+}
+
+// Moves the bits of a 32-bit value to the even bits of a 64-bit value
+inline cass_uint64_t spread_bits(cass_uint64_t value) {
+  value = (value | (value << 16)) & 0x0000FFFF0000FFFFULL;
+  value = (value | (value << 8)) & 0x00FF00FF00FF00FFULL;
+  value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  value = (value | (value << 2)) & 0x3333333333333333ULL;
+  value = (value | (value << 1)) & 0x5555555555555555ULL;
+  return value;
+}
+
+#if defined(DSE_USE_SSE2)
+inline __m128i spread_bits(__m128i value) {
+  value = _mm_and_si128(_mm_or_si128(value, _mm_slli_epi64(value, 16)),
+                        _mm_set1_epi32(0x0000FFFF));
+  value = _mm_and_si128(_mm_or_si128(value, _mm_slli_epi64(value, 8)),
+                        _mm_set1_epi32(0x00FF00FF));
+  value = _mm_and_si128(_mm_or_si128(value, _mm_slli_epi64(value, 4)),
+                        _mm_set1_epi32(0x0F0F0F0F));
+  value = _mm_and_si128(_mm_or_si128(value, _mm_slli_epi64(value, 2)),
+                        _mm_set1_epi32(0x33333333));
+  value = _mm_and_si128(_mm_or_si128(value, _mm_slli_epi64(value, 1)),
+                        _mm_set1_epi32(0x55555555));
+  return value;
+}
+#endif
+
+void interleave(const cass_uint32_t* cell_x, const cass_uint32_t* cell_y,
+                size_t count, cass_uint64_t* codes) {
+  size_t i = 0;
+#if defined(DSE_USE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 2 <= count; i += 2) {
+    __m128i x = _mm_unpacklo_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(cell_x + i)), zero);
+    __m128i y = _mm_unpacklo_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(cell_y + i)), zero);
+    __m128i code = _mm_or_si128(_mm_slli_epi64(spread_bits(x), 1), spread_bits(y));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(codes + i), code);
+  }
+#endif
+  for (; i < count; ++i) {
+    codes[i] = (spread_bits(cell_x[i]) << 1) | spread_bits(cell_y[i]);
+  }
+}
+
+cass_uint64_t hilbert_index(cass_uint32_t x, cass_uint32_t y) {
+  cass_uint64_t index = 0;
+  for (cass_uint32_t s = 1u << 31; s > 0; s >>= 1) {
+    cass_uint32_t rx = (x & s) != 0;
+    cass_uint32_t ry = (y & s) != 0;
+    index += static_cast<cass_uint64_t>(s) * s * ((3 * rx) ^ ry);
+    // Rotate the quadrant so that the curve is continuous
+    if (ry == 0) {
+      if (rx == 1) {
+        x = ~x;
+        y = ~y;
+      }
+      cass_uint32_t temp = x;
+      x = y;
+      y = temp;
+    }
+  }
+  return index;
+}
+
+} // namespace
+
+namespace dse {
+
+SpatialGrid::SpatialGrid(cass_double_t min_x, cass_double_t min_y,
+                         cass_double_t max_x, cass_double_t max_y)
+  : min_x_(min_x)
+  , min_y_(min_y)
+  , scale_x_((kMaxCell + 1.0) / (max_x - min_x))
+  , scale_y_((kMaxCell + 1.0) / (max_y - min_y)) { }
+
+void SpatialGrid::quantize(const cass_double_t* x, const cass_double_t* y,
+                           size_t num_points,
+                           cass_uint32_t* cell_x, cass_uint32_t* cell_y) const {
+  ::quantize(x, num_points, min_x_, scale_x_, cell_x);
+  ::quantize(y, num_points, min_y_, scale_y_, cell_y);
+}
+
+void SpatialGrid::morton_codes(const cass_double_t* x, const cass_double_t* y,
+                               size_t num_points,
+                               cass_uint64_t* codes) const {
+  cass_uint32_t cell_x[kChunkSize], cell_y[kChunkSize];
+  for (size_t i = 0; i < num_points; i += kChunkSize) {
+    size_t count = std::min(num_points - i, kChunkSize);
+    quantize(x + i, y + i, count, cell_x, cell_y);
+    interleave(cell_x, cell_y, count, codes + i);
+  }
+}
+
+void SpatialGrid::hilbert_indices(const cass_double_t* x, const cass_double_t* y,
+                                  size_t num_points,
+                                  cass_uint64_t* indices) const {
+  cass_uint32_t cell_x[kChunkSize], cell_y[kChunkSize];
+  for (size_t i = 0; i < num_points; i += kChunkSize) {
+    size_t count = std::min(num_points - i, kChunkSize);
+    quantize(x + i, y + i, count, cell_x, cell_y);
+    for (size_t j = 0; j < count; ++j) {
+      indices[i + j] = hilbert_index(cell_x[j], cell_y[j]);
+    }
+  }
+}
+
+void geohashes(const cass_double_t* x, const cass_double_t* y,
+               size_t num_points, size_t precision,
+               char* output) {
+  // A geohash is the base 32 encoding of the Morton code of the longitude
+  // and latitude
+  SpatialGrid grid(-180.0, -90.0, 180.0, 90.0);
+  cass_uint64_t codes[kChunkSize];
+  for (size_t i = 0; i < num_points; i += kChunkSize) {
+    size_t count = std::min(num_points - i, kChunkSize);
+    grid.morton_codes(x + i, y + i, count, codes);
+    for (size_t j = 0; j < count; ++j) {
+      cass_uint64_t code = codes[j];
+      for (size_t k = 0; k < precision; ++k) {
+        *output++ = kGeohashAlphabet[(code >> (59 - 5 * k)) & 0x1F];
+      }
+    }
+  }
+}
+
+} // namespace dse
@@ -0,0 +1,56 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_SPATIAL_KEY_HPP_INCLUDED__
+#define __DSE_SPATIAL_KEY_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "serialization.hpp"
+
+#define DSE_GEOHASH_MAX_PRECISION 12
+
+namespace dse {
+
+// Maps points to the cells of a 2^32 x 2^32 grid covering a box. Points
+// outside of the box are clamped to the nearest cell on its edge and NaN
+// coordinates are mapped to the first cell.
+class SpatialGrid {
+public:
+  SpatialGrid(cass_double_t min_x, cass_double_t min_y,
+              cass_double_t max_x, cass_double_t max_y);
+
+  // Both the Morton code and the geohash use the x coordinate for the most
+  // significant bit
+  void morton_codes(const cass_double_t* x, const cass_double_t* y,
+                    size_t num_points,
+                    cass_uint64_t* codes) const;
+
+  void hilbert_indices(const cass_double_t* x, const cass_double_t* y,
+                       size_t num_points,
+                       cass_uint64_t* indices) const;
+
+private:
+  void quantize(const cass_double_t* x, const cass_double_t* y,
+                size_t num_points,
+                cass_uint32_t* cell_x, cass_uint32_t* cell_y) const;
+
+private:
+  cass_double_t min_x_;
+  cass_double_t min_y_;
+  cass_double_t scale_x_;
+  cass_double_t scale_y_;
+};
+
+// Writes "precision" characters for each point without any terminators
+void geohashes(const cass_double_t* x, const cass_double_t* y,
+               size_t num_points, size_t precision,
+               char* output);
+
+} // namespace dse
+
+#endif
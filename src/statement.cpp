@@ -13,18 +13,14 @@
 
 namespace dse {
 
-inline Bytes encode_point(cass_double_t x, cass_double_t y) {
-  Bytes bytes;
-
-  bytes.reserve(WKB_HEADER_SIZE +       // Header
-                sizeof(cass_double_t) + // X
-                sizeof(cass_double_t)); // Y
-
-  encode_header_append(WKB_GEOMETRY_TYPE_POINT, bytes);
-  encode_append(x, bytes);
-  encode_append(y, bytes);
-
-  return bytes;
+// Points are a fixed size so they're encoded on the stack instead of in Bytes
+inline void encode_point(cass_double_t x, cass_double_t y,
+                         cass_byte_t bytes[WKB_POINT_SIZE]) {
+  const cass_uint32_t type = WKB_GEOMETRY_TYPE_POINT;
+  bytes[0] = native_byte_order();
+  memcpy(bytes + sizeof(cass_uint8_t), &type, sizeof(cass_uint32_t));
+  memcpy(bytes + WKB_HEADER_SIZE, &x, sizeof(cass_double_t));
+  memcpy(bytes + WKB_HEADER_SIZE + sizeof(cass_double_t), &y, sizeof(cass_double_t));
 }
 
 } // namespace dse
@@ -34,9 +30,10 @@ extern "C" {
 CassError cass_statement_bind_dse_point(CassStatement* statement,
                                         size_t index,
                                         cass_double_t x, cass_double_t y) {
-  dse::Bytes bytes = dse::encode_point(x, y);
+  cass_byte_t bytes[WKB_POINT_SIZE];
+  dse::encode_point(x, y, bytes);
   return cass_statement_bind_custom(statement, index, DSE_POINT_TYPE,
-                                    bytes.data(), bytes.size());
+                                    bytes, sizeof(bytes));
 }
 
 CassError cass_statement_bind_dse_point_by_name(CassStatement* statement,
@@ -50,11 +47,12 @@ CassError cass_statement_bind_dse_point_by_name(CassStatement* statement,
 CassError cass_statement_bind_dse_point_by_name_n(CassStatement* statement,
                                                   const char* name, size_t name_length,
                                                   cass_double_t x, cass_double_t y) {
-  dse::Bytes bytes = dse::encode_point(x, y);
+  cass_byte_t bytes[WKB_POINT_SIZE];
+  dse::encode_point(x, y, bytes);
   return cass_statement_bind_custom_by_name_n(statement,
                                               name, name_length,
                                               DSE_POINT_TYPE, sizeof(DSE_POINT_TYPE) - 1,
-                                              bytes.data(), bytes.size());
+                                              bytes, sizeof(bytes));
 }
 
 CassError cass_statement_bind_dse_line_string(CassStatement* statement,
@@ -11,6 +11,7 @@
 #include "dse.h"
 
 #include "string_ref.hpp"
+#include "value.hpp"
 
 namespace dse {
 
@@ -37,6 +38,33 @@ inline CassError validate_data_type(const CassValue* value,
   return CASS_OK;
 }
 
+// Validates values using the class name of their custom type, but remembers
+// the last data type that was valid. Values from the same result column share
+// a data type so iterating over a column only compares pointers after the
+// first row. A reference is held so that the address can't be reused by a
+// different data type.
+class DataTypeValidator {
+public:
+  explicit DataTypeValidator(const char* class_name)
+    : class_name_(class_name) { }
+
+  CassError validate(const CassValue* value) {
+    const cass::DataType::ConstPtr& data_type = value->data_type();
+    if (data_type_ && data_type.get() == data_type_.get()) {
+      return CASS_OK;
+    }
+    CassError rc = validate_data_type(value, class_name_);
+    if (rc == CASS_OK) {
+      data_type_ = data_type;
+    }
+    return rc;
+  }
+
+private:
+  const char* class_name_;
+  cass::DataType::ConstPtr data_type_;
+};
+
 } // namespace dse
 
 
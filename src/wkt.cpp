@@ -9,118 +9,266 @@
 
 #include "wkt.hpp"
 
-#include <stdlib.h>
-#include <string>
+#include "atod.hpp"
+#include "serialization.hpp"
 
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#endif
 
-#line 17 "wkt.cpp"
+
+#line 21 "wkt.cpp"
 static const char _wkt_actions[] = {
 	0, 1, 0, 1, 1, 1, 2, 1, 
 	5, 1, 6, 1, 7, 1, 8, 1, 
 	9, 1, 10, 1, 11, 1, 12, 1, 
 	13, 1, 14, 1, 15, 1, 16, 1, 
-	17, 2, 2, 3, 2, 2, 4
+	17, 1, 18, 1, 19, 1, 20, 1, 
+	21, 2, 2, 3, 2, 2, 4
 };
 
 static const char _wkt_key_offsets[] = {
 	0, 2, 6, 8, 9, 10, 11, 12, 
-	13, 14, 15, 16, 18, 19, 20, 21, 
-	22, 23, 24, 36, 39, 43, 45, 50, 
-	52, 53
+	13, 14, 15, 16, 17, 18, 19, 20, 
+	21, 22, 23, 24, 25, 26, 27, 28, 
+	29, 30, 31, 32, 33, 34, 35, 37, 
+	38, 39, 40, 41, 42, 43, 44, 45, 
+	46, 47, 49, 50, 51, 52, 53, 54, 
+	55, 57, 58, 59, 60, 61, 62, 63, 
+	77, 80, 84, 86, 91, 93, 94, 95, 
+	96
 };
 
 static const char _wkt_trans_keys[] = {
 	48, 57, 43, 45, 48, 57, 48, 57, 
+	79, 77, 69, 84, 82, 89, 67, 79, 
+	76, 76, 69, 67, 84, 73, 79, 78, 
 	78, 69, 83, 84, 82, 73, 78, 71, 
-	73, 76, 78, 84, 89, 71, 79, 78, 
-	9, 32, 40, 41, 44, 46, 76, 80, 
-	43, 45, 48, 57, 46, 48, 57, 69, 
-	101, 48, 57, 48, 57, 46, 69, 101, 
-	48, 57, 48, 57, 73, 79, 0
+	76, 84, 73, 76, 80, 73, 78, 69, 
+	83, 84, 82, 73, 78, 71, 79, 73, 
+	76, 78, 84, 89, 71, 79, 78, 73, 
+	76, 78, 84, 89, 71, 79, 78, 9, 
+	32, 40, 41, 44, 46, 71, 76, 77, 
+	80, 43, 45, 48, 57, 46, 48, 57, 
+	69, 101, 48, 57, 48, 57, 46, 69, 
+	101, 48, 57, 48, 57, 69, 73, 85, 
+	79, 0
 };
 
 static const char _wkt_single_lengths[] = {
 	0, 2, 0, 1, 1, 1, 1, 1, 
-	1, 1, 1, 2, 1, 1, 1, 1, 
-	1, 1, 8, 1, 2, 0, 3, 0, 
-	1, 1
+	1, 1, 1, 1, 1, 1, 1, 1, 
+	1, 1, 1, 1, 1, 1, 1, 1, 
+	1, 1, 1, 1, 1, 1, 2, 1, 
+	1, 1, 1, 1, 1, 1, 1, 1, 
+	1, 2, 1, 1, 1, 1, 1, 1, 
+	2, 1, 1, 1, 1, 1, 1, 10, 
+	1, 2, 0, 3, 0, 1, 1, 1, 
+	1
 };
 
 static const char _wkt_range_lengths[] = {
 	1, 1, 1, 0, 0, 0, 0, 0, 
 	0, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, 2, 1, 1, 1, 1, 1, 
-	0, 0
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 2, 
+	1, 1, 1, 1, 1, 0, 0, 0, 
+	0
 };
 
-static const char _wkt_index_offsets[] = {
+static const unsigned char _wkt_index_offsets[] = {
 	0, 2, 6, 8, 10, 12, 14, 16, 
-	18, 20, 22, 24, 27, 29, 31, 33, 
-	35, 37, 39, 50, 53, 57, 59, 64, 
-	66, 68
+	18, 20, 22, 24, 26, 28, 30, 32, 
+	34, 36, 38, 40, 42, 44, 46, 48, 
+	50, 52, 54, 56, 58, 60, 62, 65, 
+	67, 69, 71, 73, 75, 77, 79, 81, 
+	83, 85, 88, 90, 92, 94, 96, 98, 
+	100, 103, 105, 107, 109, 111, 113, 115, 
+	128, 131, 135, 137, 142, 144, 146, 148, 
+	150
 };
 
 static const char _wkt_trans_targs[] = {
-	20, 18, 2, 2, 21, 18, 21, 18, 
-	4, 18, 5, 18, 6, 18, 7, 18, 
-	8, 18, 9, 18, 10, 18, 18, 18, 
-	12, 14, 18, 13, 18, 18, 18, 15, 
-	18, 16, 18, 17, 18, 18, 18, 18, 
-	18, 18, 18, 18, 23, 24, 25, 19, 
-	22, 18, 0, 22, 18, 1, 1, 20, 
-	18, 21, 18, 0, 1, 1, 22, 18, 
-	20, 18, 3, 18, 11, 18, 18, 18, 
-	18, 18, 18, 18, 18, 18, 18, 18, 
-	18, 18, 18, 18, 18, 18, 18, 18, 
-	18, 18, 18, 18, 18, 18, 18, 0
+	57, 55, 2, 2, 58, 55, 58, 55, 
+	4, 55, 5, 55, 6, 55, 7, 55, 
+	8, 55, 9, 55, 10, 55, 11, 55, 
+	12, 55, 13, 55, 14, 55, 15, 55, 
+	16, 55, 17, 55, 18, 55, 55, 55, 
+	20, 55, 21, 55, 22, 55, 23, 55, 
+	24, 55, 25, 55, 26, 55, 55, 55, 
+	28, 55, 29, 55, 30, 55, 31, 40, 
+	55, 32, 55, 33, 55, 34, 55, 35, 
+	55, 36, 55, 37, 55, 38, 55, 39, 
+	55, 55, 55, 41, 55, 42, 44, 55, 
+	43, 55, 55, 55, 45, 55, 46, 55, 
+	47, 55, 55, 55, 49, 51, 55, 50, 
+	55, 55, 55, 52, 55, 53, 55, 54, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	60, 61, 62, 63, 64, 56, 59, 55, 
+	0, 59, 55, 1, 1, 57, 55, 58, 
+	55, 0, 1, 1, 59, 55, 57, 55, 
+	3, 55, 19, 55, 27, 55, 48, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	55, 55, 55, 55, 55, 55, 55, 55, 
+	0
 };
 
 static const char _wkt_trans_actions[] = {
-	5, 31, 0, 0, 0, 27, 0, 27, 
-	0, 29, 0, 29, 0, 29, 0, 29, 
-	0, 29, 0, 29, 0, 29, 9, 29, 
-	0, 0, 29, 0, 29, 7, 29, 0, 
-	29, 0, 29, 0, 29, 11, 29, 19, 
-	19, 13, 15, 17, 0, 5, 5, 36, 
-	33, 21, 0, 33, 25, 0, 0, 5, 
-	23, 0, 23, 0, 0, 0, 33, 23, 
-	5, 25, 0, 25, 0, 25, 31, 27, 
-	27, 29, 29, 29, 29, 29, 29, 29, 
-	29, 29, 29, 29, 29, 29, 29, 29, 
-	25, 23, 23, 23, 25, 25, 25, 0
+	5, 39, 0, 0, 0, 35, 0, 35, 
+	0, 37, 0, 37, 0, 37, 0, 37, 
+	0, 37, 0, 37, 0, 37, 0, 37, 
+	0, 37, 0, 37, 0, 37, 0, 37, 
+	0, 37, 0, 37, 0, 37, 19, 37, 
+	0, 37, 0, 37, 0, 37, 0, 37, 
+	0, 37, 0, 37, 0, 37, 9, 37, 
+	0, 37, 0, 37, 0, 37, 0, 0, 
+	37, 0, 37, 0, 37, 0, 37, 0, 
+	37, 0, 37, 0, 37, 0, 37, 0, 
+	37, 15, 37, 0, 37, 0, 0, 37, 
+	0, 37, 13, 37, 0, 37, 0, 37, 
+	0, 37, 17, 37, 0, 0, 37, 0, 
+	37, 7, 37, 0, 37, 0, 37, 0, 
+	37, 11, 37, 27, 27, 21, 23, 25, 
+	0, 5, 5, 5, 5, 44, 41, 29, 
+	0, 41, 33, 0, 0, 5, 31, 0, 
+	31, 0, 0, 0, 41, 31, 5, 33, 
+	0, 33, 0, 33, 0, 33, 0, 33, 
+	39, 35, 35, 37, 37, 37, 37, 37, 
+	37, 37, 37, 37, 37, 37, 37, 37, 
+	37, 37, 37, 37, 37, 37, 37, 37, 
+	37, 37, 37, 37, 37, 37, 37, 37, 
+	37, 37, 37, 37, 37, 37, 37, 37, 
+	37, 37, 37, 37, 37, 37, 37, 37, 
+	37, 37, 37, 37, 37, 37, 37, 33, 
+	31, 31, 31, 33, 33, 33, 33, 33, 
+	0
 };
 
 static const char _wkt_to_state_actions[] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 
 	0, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, 1, 0, 0, 0, 0, 0, 
-	0, 0
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 1, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0
 };
 
 static const char _wkt_from_state_actions[] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 
 	0, 0, 0, 0, 0, 0, 0, 0, 
-	0, 0, 3, 0, 0, 0, 0, 0, 
-	0, 0
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 3, 
+	0, 0, 0, 0, 0, 0, 0, 0, 
+	0
 };
 
-static const char _wkt_eof_trans[] = {
-	71, 73, 73, 88, 88, 88, 88, 88, 
-	88, 88, 88, 88, 88, 88, 88, 88, 
-	88, 88, 0, 95, 92, 92, 92, 95, 
-	95, 95
+static const unsigned char _wkt_eof_trans[] = {
+	153, 155, 155, 207, 207, 207, 207, 207, 
+	207, 207, 207, 207, 207, 207, 207, 207, 
+	207, 207, 207, 207, 207, 207, 207, 207, 
+	207, 207, 207, 207, 207, 207, 207, 207, 
+	207, 207, 207, 207, 207, 207, 207, 207, 
+	207, 207, 207, 207, 207, 207, 207, 207, 
+	207, 207, 207, 207, 207, 207, 207, 0, 
+	216, 211, 211, 211, 216, 216, 216, 216, 
+	216
 };
 
-static const int wkt_start = 18;
-static const int wkt_first_final = 18;
+static const int wkt_start = 55;
+static const int wkt_first_final = 55;
 static const int wkt_error = -1;
 
-static const int wkt_en_main = 18;
+static const int wkt_en_main = 55;
+
+
+#line 20 "wkt.rl"
+
+
+namespace {
+
+// Whitespace and numbers make up most of WKT so they're found 16 bytes at a
+// time before falling back to the state machine for everything else.
+
+inline bool is_whitespace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+inline bool is_number(char c) {
+  return (c >= '0' && c <= '9') ||
+      c == '.' || c == '+' || c == '-' || c == 'e' || c == 'E';
+}
 
+#if defined(DSE_USE_SSE2)
+inline int count_trailing_zeros(unsigned mask) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
 
-#line 16 "wkt.rl"
+inline unsigned whitespace_mask(__m128i block) {
+  __m128i mask = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+  return static_cast<unsigned>(_mm_movemask_epi8(mask));
+}
+
+inline unsigned number_mask(__m128i block) {
+  __m128i mask = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)),
+                               _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('.')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('+')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('-')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('e')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('E')));
+  return static_cast<unsigned>(_mm_movemask_epi8(mask));
+}
+#endif
+
+const char* skip_whitespace(const char* p, const char* end) {
+#if defined(DSE_USE_SSE2)
+  while (end - p >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    unsigned mask = ~whitespace_mask(block) & 0xFFFF;
+    if (mask != 0) return p + count_trailing_zeros(mask);
+    p += 16;
+  }
+#endif
+  while (p != end && is_whitespace(*p)) ++p;
+  return p;
+}
 
+const char* skip_number(const char* p, const char* end) {
+#if defined(DSE_USE_SSE2)
+  while (end - p >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    unsigned mask = ~number_mask(block) & 0xFFFF;
+    if (mask != 0) return p + count_trailing_zeros(mask);
+    p += 16;
+  }
+#endif
+  while (p != end && is_number(*p)) ++p;
+  return p;
+}
 
+} // namespace
 
 WktLexer::Token WktLexer::next_token() {
   Token token = TK_INVALID;
@@ -137,10 +285,34 @@ WktLexer::Token WktLexer::next_token() {
   (void)wkt_error;
   (void)wkt_en_main;
 
-  if (p == eof) return TK_EOF;
+  p = skip_whitespace(p, pe);
+  if (p == eof) {
+    position_ = p;
+    return TK_EOF;
+  }
+
+  // Handle the most common tokens without the state machine. A run of number
+  // characters that isn't a single valid number (e.g. "1-2") is left to the
+  // state machine to split up.
+  switch (*p) {
+    case '(': position_ = p + 1; return TK_OPEN_PAREN;
+    case ')': position_ = p + 1; return TK_CLOSE_PAREN;
+    case ',': position_ = p + 1; return TK_COMMA;
+    default:
+      if (is_number(*p)) {
+        const char* number_end = skip_number(p, pe);
+        double number;
+        if (dse::atod(p, number_end, &number)) {
+          if (!skip_number_) number_ = number;
+          position_ = number_end;
+          return TK_NUMBER;
+        }
+      }
+      break;
+  }
 
   
-#line 144 "wkt.cpp"
+#line 316 "wkt.cpp"
 	{
 	cs = wkt_start;
 	ts = 0;
@@ -148,7 +320,7 @@ WktLexer::Token WktLexer::next_token() {
 	act = 0;
 	}
 
-#line 152 "wkt.cpp"
+#line 324 "wkt.cpp"
 	{
 	int _klen;
 	unsigned int _trans;
@@ -167,7 +339,7 @@ _resume:
 #line 1 "NONE"
 	{ts = p;}
 	break;
-#line 171 "wkt.cpp"
+#line 343 "wkt.cpp"
 		}
 	}
 
@@ -237,92 +409,108 @@ _eof_trans:
 	{te = p+1;}
 	break;
 	case 3:
-#line 47 "wkt.rl"
-	{act = 7;}
+#line 149 "wkt.rl"
+	{act = 11;}
 	break;
 	case 4:
-#line 55 "wkt.rl"
-	{act = 9;}
+#line 157 "wkt.rl"
+	{act = 13;}
 	break;
 	case 5:
-#line 41 "wkt.rl"
+#line 139 "wkt.rl"
 	{te = p+1;{ token = TK_TYPE_POINT; {p++; goto _out; } }}
 	break;
 	case 6:
-#line 42 "wkt.rl"
+#line 140 "wkt.rl"
 	{te = p+1;{ token = TK_TYPE_LINESTRING; {p++; goto _out; } }}
 	break;
 	case 7:
-#line 43 "wkt.rl"
+#line 141 "wkt.rl"
 	{te = p+1;{ token = TK_TYPE_POLYGON; {p++; goto _out; } }}
 	break;
 	case 8:
-#line 44 "wkt.rl"
-	{te = p+1;{ token = TK_OPEN_PAREN; {p++; goto _out; } }}
+#line 142 "wkt.rl"
+	{te = p+1;{ token = TK_TYPE_MULTIPOINT; {p++; goto _out; } }}
 	break;
 	case 9:
-#line 45 "wkt.rl"
-	{te = p+1;{ token = TK_CLOSE_PAREN; {p++; goto _out; } }}
+#line 143 "wkt.rl"
+	{te = p+1;{ token = TK_TYPE_MULTILINESTRING; {p++; goto _out; } }}
 	break;
 	case 10:
-#line 46 "wkt.rl"
-	{te = p+1;{ token = TK_COMMA; {p++; goto _out; } }}
+#line 144 "wkt.rl"
+	{te = p+1;{ token = TK_TYPE_MULTIPOLYGON; {p++; goto _out; } }}
 	break;
 	case 11:
-#line 54 "wkt.rl"
-	{te = p+1;{ /* Skip */ }}
+#line 145 "wkt.rl"
+	{te = p+1;{ token = TK_TYPE_GEOMETRYCOLLECTION; {p++; goto _out; } }}
 	break;
 	case 12:
-#line 55 "wkt.rl"
-	{te = p+1;{ token = TK_INVALID; {p++; goto _out; } }}
+#line 146 "wkt.rl"
+	{te = p+1;{ token = TK_OPEN_PAREN; {p++; goto _out; } }}
 	break;
 	case 13:
-#line 47 "wkt.rl"
+#line 147 "wkt.rl"
+	{te = p+1;{ token = TK_CLOSE_PAREN; {p++; goto _out; } }}
+	break;
+	case 14:
+#line 148 "wkt.rl"
+	{te = p+1;{ token = TK_COMMA; {p++; goto _out; } }}
+	break;
+	case 15:
+#line 156 "wkt.rl"
+	{te = p+1;{ /* Skip */ }}
+	break;
+	case 16:
+#line 157 "wkt.rl"
+	{te = p+1;{ token = TK_INVALID; {p++; goto _out; } }}
+	break;
+	case 17:
+#line 149 "wkt.rl"
 	{te = p;p--;{
                    if (!skip_number_) {
-                     number_ = atof(std::string(ts, te).c_str());
+                     dse::atod(ts, te, &number_);
                    }
                    token = TK_NUMBER;
                    {p++; goto _out; }
                 }}
 	break;
-	case 14:
-#line 55 "wkt.rl"
+	case 18:
+#line 157 "wkt.rl"
 	{te = p;p--;{ token = TK_INVALID; {p++; goto _out; } }}
 	break;
-	case 15:
-#line 47 "wkt.rl"
+	case 19:
+#line 149 "wkt.rl"
 	{{p = ((te))-1;}{
                    if (!skip_number_) {
-                     number_ = atof(std::string(ts, te).c_str());
+                     dse::atod(ts, te, &number_);
                    }
                    token = TK_NUMBER;
                    {p++; goto _out; }
                 }}
 	break;
-	case 16:
-#line 55 "wkt.rl"
+	case 20:
+#line 157 "wkt.rl"
 	{{p = ((te))-1;}{ token = TK_INVALID; {p++; goto _out; } }}
 	break;
-	case 17:
+	case 21:
 #line 1 "NONE"
 	{	switch( act ) {
-	case 7:
+	case 11:
 	{{p = ((te))-1;}
                    if (!skip_number_) {
-                     number_ = atof(std::string(ts, te).c_str());
+                     dse::atod(ts, te, &number_);
                    }
                    token = TK_NUMBER;
                    {p++; goto _out; }
                 }
 	break;
-	case 9:
+	case 13:
 	{{p = ((te))-1;} token = TK_INVALID; {p++; goto _out; } }
 	break;
 	}
 	}
 	break;
-#line 326 "wkt.cpp"
+#line 514 "wkt.cpp"
 		}
 	}
 
@@ -335,7 +523,7 @@ _again:
 #line 1 "NONE"
 	{ts = 0;}
 	break;
-#line 339 "wkt.cpp"
+#line 527 "wkt.cpp"
 		}
 	}
 
@@ -353,7 +541,7 @@ _again:
 	_out: {}
 	}
 
-#line 60 "wkt.rl"
+#line 162 "wkt.rl"
 
 
   position_ = p;
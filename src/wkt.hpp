@@ -18,6 +18,10 @@
   XX(TK_TYPE_POINT) \
   XX(TK_TYPE_LINESTRING) \
   XX(TK_TYPE_POLYGON) \
+  XX(TK_TYPE_MULTIPOINT) \
+  XX(TK_TYPE_MULTILINESTRING) \
+  XX(TK_TYPE_MULTIPOLYGON) \
+  XX(TK_TYPE_GEOMETRYCOLLECTION) \
   XX(TK_NUMBER) \
   XX(TK_COMMA) \
   XX(TK_OPEN_PAREN) \
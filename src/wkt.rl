@@ -7,14 +7,88 @@
 
 #include "wkt.hpp"
 
-#include <stdlib.h>
-#include <string>
+#include "atod.hpp"
+#include "serialization.hpp"
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#endif
 
 %%{
   machine wkt;
   write data;
 }%%
 
+namespace {
+
+// Whitespace and numbers make up most of WKT so they're found 16 bytes at a
+// time before falling back to the state machine for everything else.
+
+inline bool is_whitespace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+inline bool is_number(char c) {
+  return (c >= '0' && c <= '9') ||
+      c == '.' || c == '+' || c == '-' || c == 'e' || c == 'E';
+}
+
+#if defined(DSE_USE_SSE2)
+inline int count_trailing_zeros(unsigned mask) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+inline unsigned whitespace_mask(__m128i block) {
+  __m128i mask = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+  return static_cast<unsigned>(_mm_movemask_epi8(mask));
+}
+
+inline unsigned number_mask(__m128i block) {
+  __m128i mask = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)),
+                               _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('.')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('+')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('-')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('e')));
+  mask = _mm_or_si128(mask, _mm_cmpeq_epi8(block, _mm_set1_epi8('E')));
+  return static_cast<unsigned>(_mm_movemask_epi8(mask));
+}
+#endif
+
+const char* skip_whitespace(const char* p, const char* end) {
+#if defined(DSE_USE_SSE2)
+  while (end - p >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    unsigned mask = ~whitespace_mask(block) & 0xFFFF;
+    if (mask != 0) return p + count_trailing_zeros(mask);
+    p += 16;
+  }
+#endif
+  while (p != end && is_whitespace(*p)) ++p;
+  return p;
+}
+
+const char* skip_number(const char* p, const char* end) {
+#if defined(DSE_USE_SSE2)
+  while (end - p >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    unsigned mask = ~number_mask(block) & 0xFFFF;
+    if (mask != 0) return p + count_trailing_zeros(mask);
+    p += 16;
+  }
+#endif
+  while (p != end && is_number(*p)) ++p;
+  return p;
+}
+
+} // namespace
 
 WktLexer::Token WktLexer::next_token() {
   Token token = TK_INVALID;
@@ -31,7 +105,31 @@ WktLexer::Token WktLexer::next_token() {
   (void)wkt_error;
   (void)wkt_en_main;
 
-  if (p == eof) return TK_EOF;
+  p = skip_whitespace(p, pe);
+  if (p == eof) {
+    position_ = p;
+    return TK_EOF;
+  }
+
+  // Handle the most common tokens without the state machine. A run of number
+  // characters that isn't a single valid number (e.g. "1-2") is left to the
+  // state machine to split up.
+  switch (*p) {
+    case '(': position_ = p + 1; return TK_OPEN_PAREN;
+    case ')': position_ = p + 1; return TK_CLOSE_PAREN;
+    case ',': position_ = p + 1; return TK_COMMA;
+    default:
+      if (is_number(*p)) {
+        const char* number_end = skip_number(p, pe);
+        double number;
+        if (dse::atod(p, number_end, &number)) {
+          if (!skip_number_) number_ = number;
+          position_ = number_end;
+          return TK_NUMBER;
+        }
+      }
+      break;
+  }
 
   %%{
     ws = [ \t];
@@ -41,12 +139,16 @@ WktLexer::Token WktLexer::next_token() {
       'POINT' => { token = TK_TYPE_POINT; fbreak; };
       'LINESTRING' => { token = TK_TYPE_LINESTRING; fbreak; };
       'POLYGON' => { token = TK_TYPE_POLYGON; fbreak; };
+      'MULTIPOINT' => { token = TK_TYPE_MULTIPOINT; fbreak; };
+      'MULTILINESTRING' => { token = TK_TYPE_MULTILINESTRING; fbreak; };
+      'MULTIPOLYGON' => { token = TK_TYPE_MULTIPOLYGON; fbreak; };
+      'GEOMETRYCOLLECTION' => { token = TK_TYPE_GEOMETRYCOLLECTION; fbreak; };
       '(' => { token = TK_OPEN_PAREN; fbreak; };
       ')' => { token = TK_CLOSE_PAREN; fbreak; };
       ',' => { token = TK_COMMA; fbreak; };
       number => {
                    if (!skip_number_) {
-                     number_ = atof(std::string(ts, te).c_str());
+                     dse::atod(ts, te, &number_);
                    }
                    token = TK_NUMBER;
                    fbreak;
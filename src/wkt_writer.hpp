@@ -0,0 +1,178 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#ifndef __DSE_WKT_WRITER_HPP_INCLUDED__
+#define __DSE_WKT_WRITER_HPP_INCLUDED__
+
+#include "dse.h"
+
+#include "dtoa.hpp"
+#include "serialization.hpp"
+
+// Longest number written by dtoa() e.g. "-2.2250738585072014e-308"
+#define WKT_MAX_NUMBER_SIZE 24
+
+// "POINT (x y)"
+#define WKT_MAX_POINT_SIZE (sizeof("POINT ( )") - 1 + 2 * WKT_MAX_NUMBER_SIZE)
+
+// Upper bound for the size of the WKT written for a WKB geometry. No part of
+// WKB produces more than 5 characters of WKT per byte: a point's 16 bytes
+// produce at most 51 characters and a header's 5 bytes produce at most a tag,
+// parentheses and a separator.
+#define WKT_MAX_SIZE(wkb_size) (5 * (wkb_size) + 2)
+
+namespace dse {
+
+// Appends to memory that has already been reserved using WKT_MAX_SIZE() or
+// WKT_MAX_POINT_SIZE
+class WktFixedBuffer {
+public:
+  explicit WktFixedBuffer(char* data)
+    : data_(data)
+    , position_(data) { }
+
+  size_t size() const { return position_ - data_; }
+
+  void append(const char* str, size_t length) {
+    memcpy(position_, str, length);
+    position_ += length;
+  }
+
+private:
+  char* data_;
+  char* position_;
+};
+
+// Writes WKT directly into a buffer without using iostreams. The buffer only
+// needs an "append(const char*, size_t)" method (e.g. std::string) and can be
+// reused between geometries to avoid allocations.
+template <class Buffer>
+class WktWriter {
+public:
+  explicit WktWriter(Buffer& buffer)
+    : buffer_(buffer) { }
+
+  void write(const char* str, size_t length) {
+    buffer_.append(str, length);
+  }
+
+  void write_tag(WkbGeometryType type) {
+    switch (type) {
+      case WKB_GEOMETRY_TYPE_POINT: write_literal("POINT "); break;
+      case WKB_GEOMETRY_TYPE_LINESTRING: write_literal("LINESTRING "); break;
+      case WKB_GEOMETRY_TYPE_POLYGON: write_literal("POLYGON "); break;
+      case WKB_GEOMETRY_TYPE_MULTIPOINT: write_literal("MULTIPOINT "); break;
+      case WKB_GEOMETRY_TYPE_MULTILINESTRING: write_literal("MULTILINESTRING "); break;
+      case WKB_GEOMETRY_TYPE_MULTIPOLYGON: write_literal("MULTIPOLYGON "); break;
+      case WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION: write_literal("GEOMETRYCOLLECTION "); break;
+    }
+  }
+
+  void write_number(cass_double_t value) {
+    char temp[DTOA_BUFFER_SIZE];
+    write(temp, dtoa(value, temp));
+  }
+
+  // "POINT (x y)"
+  void write_point(cass_double_t x, cass_double_t y) {
+    write_tag(WKB_GEOMETRY_TYPE_POINT);
+    write_literal("(");
+    write_coordinates(x, y);
+    write_literal(")");
+  }
+
+  // "(x y, x y, ...)"
+  const cass_byte_t* write_points(const cass_byte_t* pos,
+                                  cass_uint32_t num_points,
+                                  WkbByteOrder byte_order) {
+    write_literal("(");
+    for (cass_uint32_t i = 0; i < num_points; ++i) {
+      if (i > 0) write_literal(", ");
+      pos = write_coordinates(pos, byte_order);
+    }
+    write_literal(")");
+    return pos;
+  }
+
+  // "((x y, ...), (x y, ...), ...)" where each ring starts with its number of
+  // points
+  const cass_byte_t* write_rings(const cass_byte_t* pos,
+                                 cass_uint32_t num_rings,
+                                 WkbByteOrder byte_order) {
+    write_literal("(");
+    for (cass_uint32_t i = 0; i < num_rings; ++i) {
+      if (i > 0) write_literal(", ");
+      cass_uint32_t num_points = decode_uint32(pos, byte_order);
+      pos = write_points(pos + sizeof(cass_uint32_t), num_points, byte_order);
+    }
+    write_literal(")");
+    return pos;
+  }
+
+  // Writes any WKB geometry. The elements of geometry collections are always
+  // tagged with their type.
+  const cass_byte_t* write_geometry(const cass_byte_t* pos, bool tagged) {
+    WkbByteOrder byte_order;
+    WkbGeometryType type = decode_header(pos, &byte_order);
+    pos += WKB_HEADER_SIZE;
+
+    if (tagged) write_tag(type);
+
+    if (type == WKB_GEOMETRY_TYPE_POINT) {
+      write_literal("(");
+      pos = write_coordinates(pos, byte_order);
+      write_literal(")");
+      return pos;
+    }
+
+    cass_uint32_t num_elements = decode_uint32(pos, byte_order);
+    pos += sizeof(cass_uint32_t);
+
+    if (type == WKB_GEOMETRY_TYPE_LINESTRING) {
+      return write_points(pos, num_elements, byte_order);
+    }
+
+    if (type == WKB_GEOMETRY_TYPE_POLYGON) {
+      return write_rings(pos, num_elements, byte_order);
+    }
+
+    write_literal("(");
+    for (cass_uint32_t i = 0; i < num_elements; ++i) {
+      if (i > 0) write_literal(", ");
+      pos = write_geometry(pos, type == WKB_GEOMETRY_TYPE_GEOMETRYCOLLECTION);
+    }
+    write_literal(")");
+    return pos;
+  }
+
+private:
+  template <size_t N>
+  void write_literal(const char (&str)[N]) {
+    write(str, N - 1);
+  }
+
+  void write_coordinates(cass_double_t x, cass_double_t y) {
+    write_number(x);
+    write_literal(" ");
+    write_number(y);
+  }
+
+  const cass_byte_t* write_coordinates(const cass_byte_t* pos,
+                                       WkbByteOrder byte_order) {
+    cass_double_t x = decode_double(pos, byte_order);
+    cass_double_t y = decode_double(pos + sizeof(cass_double_t), byte_order);
+    write_coordinates(x, y);
+    return pos + 2 * sizeof(cass_double_t);
+  }
+
+private:
+  Buffer& buffer_;
+};
+
+} // namespace dse
+
+#endif
@@ -0,0 +1,113 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "atod.hpp"
+#include "dtoa.hpp"
+
+#include <limits>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+static bool parse(const std::string& str, double* value) {
+  return dse::atod(str.data(), str.data() + str.size(), value);
+}
+
+static cass_uint64_t to_bits(double value) {
+  cass_uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// Compares the bit representations to distinguish -0.0 from 0.0
+#define EXPECT_PARSE_EQ(expected, str) do { \
+  double value; \
+  ASSERT_TRUE(parse(str, &value)) << str; \
+  EXPECT_EQ(to_bits(expected), to_bits(value)) << str; \
+} while (0)
+
+TEST(AtodUnitTest, Simple) {
+  EXPECT_PARSE_EQ(0.0, "0");
+  EXPECT_PARSE_EQ(-0.0, "-0");
+  EXPECT_PARSE_EQ(-0.0, "-0.000e10");
+  EXPECT_PARSE_EQ(1.0, "1");
+  EXPECT_PARSE_EQ(1.0, "+1");
+  EXPECT_PARSE_EQ(-1.5, "-1.5");
+  EXPECT_PARSE_EQ(0.5, ".5");
+  EXPECT_PARSE_EQ(0.1, "0.1");
+  EXPECT_PARSE_EQ(123.456, "123.456");
+  EXPECT_PARSE_EQ(1e23, "1e23");
+  EXPECT_PARSE_EQ(2.5e-5, "2.5E-05");
+  EXPECT_PARSE_EQ(1e22, "1e+22");
+}
+
+TEST(AtodUnitTest, Limits) {
+  EXPECT_PARSE_EQ(std::numeric_limits<double>::max(), "1.7976931348623157e308");
+  EXPECT_PARSE_EQ(std::numeric_limits<double>::min(), "2.2250738585072014e-308");
+  EXPECT_PARSE_EQ(std::numeric_limits<double>::denorm_min(), "4.9406564584124654e-324");
+  EXPECT_PARSE_EQ(std::numeric_limits<double>::denorm_min(), "2.4703282292062328e-324");
+  EXPECT_PARSE_EQ(0.0, "2.4703282292062327e-324");
+  EXPECT_PARSE_EQ(0.0, "1e-400");
+  EXPECT_PARSE_EQ(std::numeric_limits<double>::infinity(), "1.7976931348623159e308");
+  EXPECT_PARSE_EQ(-std::numeric_limits<double>::infinity(), "-1e400");
+}
+
+TEST(AtodUnitTest, ManyDigits) {
+  // 2^53 + 1 is halfway between two doubles and rounds to even
+  EXPECT_PARSE_EQ(9007199254740992.0, "9007199254740993");
+  // ...but any non-zero digit past the 19th digit makes it round up
+  EXPECT_PARSE_EQ(9007199254740994.0, "9007199254740993.00000000000000000001");
+  EXPECT_PARSE_EQ(1.2345678901234568e29, "123456789012345678901234567890");
+  EXPECT_PARSE_EQ(1e-36, "0.000000000000000000000000000000000001");
+  // Exactly halfway between the smallest subnormal and zero with a trailing
+  // digit
+  EXPECT_PARSE_EQ(std::numeric_limits<double>::denorm_min(),
+                  "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996189898282347722858865463328355177969898199387398005390939063150356595155702263922908583924491051844359318028499365361525003193704576782492193656236698636584807570015857692699037063119282795585513329278343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378573934507363390079677619305775067401763246736009689513405355374585166611342237666786041621596804619144672918403005300575308490487653917113865916462395249126236538818796362393732804238910186723484976682350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854513962138377228261454376934125320985913276672363281255e-324");
+}
+
+TEST(AtodUnitTest, Invalid) {
+  double value;
+  EXPECT_FALSE(parse("", &value));
+  EXPECT_FALSE(parse("-", &value));
+  EXPECT_FALSE(parse(".", &value));
+  EXPECT_FALSE(parse("1.", &value));
+  EXPECT_FALSE(parse("1e", &value));
+  EXPECT_FALSE(parse("1e+", &value));
+  EXPECT_FALSE(parse("e1", &value));
+  EXPECT_FALSE(parse("1.2.3", &value));
+  EXPECT_FALSE(parse("1 ", &value));
+}
+
+TEST(AtodUnitTest, RoundTrip) {
+  srand(0);
+  for (int i = 0; i < 100000; ++i) {
+    cass_uint64_t bits = (static_cast<cass_uint64_t>(rand()) << 62) ^
+                         (static_cast<cass_uint64_t>(rand()) << 31) ^
+                         static_cast<cass_uint64_t>(rand());
+    double expected;
+    memcpy(&expected, &bits, sizeof(expected));
+    if (expected != expected ||
+        expected == std::numeric_limits<double>::infinity() ||
+        expected == -std::numeric_limits<double>::infinity()) {
+      continue;
+    }
+
+    // Shortest representation
+    char buffer[DTOA_BUFFER_SIZE];
+    size_t length = dse::dtoa(expected, buffer);
+    EXPECT_PARSE_EQ(expected, std::string(buffer, length));
+
+    // Longer and shorter representations that aren't exactly the value
+    char temp[64];
+    int precision = 1 + i % 25;
+    snprintf(temp, sizeof(temp), "%.*e", precision, expected);
+    EXPECT_PARSE_EQ(strtod(temp, NULL), std::string(temp));
+  }
+}
@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "dtoa.hpp"
+
+#include <limits>
+#include <stdlib.h>
+#include <string>
+
+static std::string to_string(double value) {
+  char buffer[DTOA_BUFFER_SIZE];
+  size_t length = dse::dtoa(value, buffer);
+  EXPECT_EQ(strlen(buffer), length);
+  return std::string(buffer, length);
+}
+
+TEST(DtoaUnitTest, Shortest) {
+  EXPECT_EQ("0", to_string(0.0));
+  EXPECT_EQ("-0", to_string(-0.0));
+  EXPECT_EQ("1", to_string(1.0));
+  EXPECT_EQ("-1.5", to_string(-1.5));
+  EXPECT_EQ("0.1", to_string(0.1));
+  EXPECT_EQ("0.3", to_string(0.3));
+  EXPECT_EQ("0.30000000000000004", to_string(0.1 + 0.2));
+  EXPECT_EQ("0.0001", to_string(0.0001));
+  EXPECT_EQ("123.456", to_string(123.456));
+  EXPECT_EQ("10000000000000000", to_string(1e16));
+}
+
+TEST(DtoaUnitTest, Exponent) {
+  EXPECT_EQ("1e-05", to_string(0.00001));
+  EXPECT_EQ("2.5e-05", to_string(0.000025));
+  EXPECT_EQ("1e+17", to_string(1e17));
+  EXPECT_EQ("1.7976931348623157e+308", to_string(std::numeric_limits<double>::max()));
+  EXPECT_EQ("5e-324", to_string(std::numeric_limits<double>::denorm_min()));
+}
+
+TEST(DtoaUnitTest, Special) {
+  EXPECT_EQ("inf", to_string(std::numeric_limits<double>::infinity()));
+  EXPECT_EQ("-inf", to_string(-std::numeric_limits<double>::infinity()));
+  EXPECT_EQ("nan", to_string(std::numeric_limits<double>::quiet_NaN()));
+}
+
+TEST(DtoaUnitTest, RoundTrip) {
+  srand(0);
+  for (int i = 0; i < 100000; ++i) {
+    cass_uint64_t bits = (static_cast<cass_uint64_t>(rand()) << 62) ^
+                         (static_cast<cass_uint64_t>(rand()) << 31) ^
+                         static_cast<cass_uint64_t>(rand());
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    if (value != value ||
+        value == std::numeric_limits<double>::infinity() ||
+        value == -std::numeric_limits<double>::infinity()) {
+      continue;
+    }
+    double result = strtod(to_string(value).c_str(), NULL);
+    ASSERT_EQ(0, memcmp(&value, &result, sizeof(double))) << to_string(value);
+  }
+}
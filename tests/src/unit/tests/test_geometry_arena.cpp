@@ -0,0 +1,60 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "geometry_arena.hpp"
+
+class GeometryArenaUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    arena = dse_geometry_arena_new();
+  }
+
+  void TearDown() {
+    dse_geometry_arena_free(arena);
+  }
+
+  DseGeometryArena* arena;
+};
+
+TEST_F(GeometryArenaUnitTest, Reuse) {
+  DseLineString* first = dse_geometry_arena_new_line_string(arena);
+  DseLineString* second = dse_geometry_arena_new_line_string(arena);
+  ASSERT_NE(first, second);
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(CASS_OK, dse_line_string_add_point(first, i, i));
+  }
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(first));
+  size_t capacity = first->bytes().capacity();
+
+  dse_geometry_arena_reset(arena);
+
+  // The same builders are returned empty, but keep their memory
+  ASSERT_EQ(first, dse_geometry_arena_new_line_string(arena));
+  ASSERT_EQ("LINESTRING ()", first->to_wkt());
+  ASSERT_EQ(capacity, first->bytes().capacity());
+  ASSERT_EQ(second, dse_geometry_arena_new_line_string(arena));
+  ASSERT_NE(second, dse_geometry_arena_new_line_string(arena));
+}
+
+TEST_F(GeometryArenaUnitTest, Polygons) {
+  DsePolygon* polygon = dse_geometry_arena_new_polygon(arena);
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 0, 1));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 2, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 4, 5));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+  ASSERT_EQ("POLYGON ((0 1, 2 3, 4 5))", polygon->to_wkt());
+
+  dse_geometry_arena_reset(arena);
+
+  ASSERT_EQ(polygon, dse_geometry_arena_new_polygon(arena));
+  ASSERT_EQ("POLYGON ()", polygon->to_wkt());
+}
@@ -0,0 +1,125 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "geometry_collection.hpp"
+
+#include <value.hpp>
+
+class GeometryCollectionUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    collection = dse_geometry_collection_new();
+  }
+
+  void TearDown() {
+    dse_geometry_collection_free(collection);
+  }
+
+  const CassValue* to_value() {
+    char* data = const_cast<char*>(reinterpret_cast<const char*>(collection->bytes().data()));
+    value =  cass::Value(0, // Not used
+                         cass::DataType::ConstPtr(new cass::CustomType(DSE_GEOMETRY_COLLECTION_TYPE)),
+                         data, collection->bytes().size());
+    return CassValue::to(&value);
+  }
+
+  void build() {
+    dse::LineString line_string;
+    line_string.add_point(2, 3);
+    line_string.add_point(4, 5);
+    ASSERT_EQ(CASS_OK, line_string.finish());
+
+    dse::Polygon polygon;
+    polygon.start_ring();
+    polygon.add_point(6, 7);
+    polygon.add_point(8, 9);
+    polygon.add_point(10, 11);
+    ASSERT_EQ(CASS_OK, polygon.finish());
+
+    ASSERT_EQ(CASS_OK, dse_geometry_collection_add_point(collection, 0, 1));
+    ASSERT_EQ(CASS_OK, dse_geometry_collection_add_line_string(collection,
+                                                               DseLineString::to(&line_string)));
+    ASSERT_EQ(CASS_OK, dse_geometry_collection_add_polygon(collection,
+                                                           DsePolygon::to(&polygon)));
+    ASSERT_EQ(CASS_OK, dse_geometry_collection_finish(collection));
+  }
+
+  void verify(dse::GeometryCollectionIterator& iterator) {
+    ASSERT_EQ(3u, iterator.num_geometries());
+
+    DseGeometryType type;
+    dse::LineStringIterator line_string;
+    dse::PolygonIterator polygon;
+    cass_uint32_t num_points;
+    cass_double_t x, y;
+
+    ASSERT_EQ(CASS_OK, iterator.next_type(&type));
+    ASSERT_EQ(DSE_GEOMETRY_TYPE_POINT, type);
+    ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_polygon(&polygon));
+    ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+    ASSERT_EQ(0.0, x); ASSERT_EQ(1.0, y);
+
+    ASSERT_EQ(CASS_OK, iterator.next_type(&type));
+    ASSERT_EQ(DSE_GEOMETRY_TYPE_LINE_STRING, type);
+    ASSERT_EQ(CASS_OK, iterator.next_line_string(&line_string));
+    ASSERT_EQ(2u, line_string.num_points());
+    ASSERT_EQ(CASS_OK, line_string.next_point(&x, &y));
+    ASSERT_EQ(2.0, x); ASSERT_EQ(3.0, y);
+
+    ASSERT_EQ(CASS_OK, iterator.next_type(&type));
+    ASSERT_EQ(DSE_GEOMETRY_TYPE_POLYGON, type);
+    ASSERT_EQ(CASS_OK, iterator.next_polygon(&polygon));
+    ASSERT_EQ(1u, polygon.num_rings());
+    ASSERT_EQ(CASS_OK, polygon.next_num_points(&num_points));
+    ASSERT_EQ(3u, num_points);
+    ASSERT_EQ(CASS_OK, polygon.next_point(&x, &y));
+    ASSERT_EQ(6.0, x); ASSERT_EQ(7.0, y);
+
+    ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_type(&type));
+  }
+
+  DseGeometryCollection* collection;
+  cass::Value value;
+};
+
+TEST_F(GeometryCollectionUnitTest, BinaryEmpty) {
+  ASSERT_EQ(CASS_OK, dse_geometry_collection_finish(collection));
+
+  dse::GeometryCollectionIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(0u, iterator.num_geometries());
+}
+
+TEST_F(GeometryCollectionUnitTest, BinaryMixed) {
+  build();
+
+  dse::GeometryCollectionIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  verify(iterator);
+}
+
+TEST_F(GeometryCollectionUnitTest, TextMixed) {
+  build();
+
+  std::string wkt = collection->to_wkt();
+  ASSERT_EQ("GEOMETRYCOLLECTION (POINT (0 1), LINESTRING (2 3, 4 5), "
+            "POLYGON ((6 7, 8 9, 10 11)))", wkt);
+
+  dse::GeometryCollectionIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  verify(iterator);
+}
+
+TEST_F(GeometryCollectionUnitTest, TextNestedCollection) {
+  const char* wkt = "GEOMETRYCOLLECTION (MULTIPOINT ((0 1)))";
+
+  dse::GeometryCollectionIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, iterator.reset_text(wkt, strlen(wkt)));
+}
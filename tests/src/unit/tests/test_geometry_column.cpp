@@ -0,0 +1,130 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "geometry_column.hpp"
+#include "line_string.hpp"
+
+#include <value.hpp>
+#include <data_type.hpp>
+
+#include <list>
+
+class GeometryColumnUnitTest : public testing::Test {
+public:
+  const CassValue* to_value(const dse::Bytes& bytes, const char* class_name) {
+    values.push_back(cass::Value(0, // Not used
+                                 cass::DataType::ConstPtr(new cass::CustomType(class_name)),
+                                 const_cast<char*>(reinterpret_cast<const char*>(bytes.data())),
+                                 bytes.size()));
+    return CassValue::to(&values.back());
+  }
+
+  const CassValue* to_null_value(const char* class_name) {
+    values.push_back(cass::Value(0, // Not used
+                                 cass::DataType::ConstPtr(new cass::CustomType(class_name)),
+                                 NULL, -1)); // Null values have a negative size
+    return CassValue::to(&values.back());
+  }
+
+  dse::GeometryColumn column;
+  std::list<cass::Value> values;
+};
+
+TEST_F(GeometryColumnUnitTest, Points) {
+  column.clear(dse::WKB_GEOMETRY_TYPE_POINT);
+
+  std::vector<dse::Bytes> points(3);
+  for (size_t i = 0; i < points.size(); ++i) {
+    dse::encode_header_append(dse::WKB_GEOMETRY_TYPE_POINT, points[i]);
+    dse::encode_append(static_cast<cass_double_t>(2 * i), points[i]);
+    dse::encode_append(static_cast<cass_double_t>(2 * i + 1), points[i]);
+    ASSERT_EQ(CASS_OK, column.append(to_value(points[i], DSE_POINT_TYPE)));
+  }
+  ASSERT_EQ(CASS_OK, column.append(to_null_value(DSE_POINT_TYPE)));
+
+  ASSERT_EQ(4u, column.num_rows());
+  ASSERT_EQ(3u, column.num_points());
+  const size_t expected_offsets[] = { 0, 1, 2, 3, 3 };
+  for (size_t i = 0; i <= column.num_rows(); ++i) {
+    ASSERT_EQ(expected_offsets[i], column.offsets()[i]);
+  }
+  for (size_t i = 0; i < column.num_points(); ++i) {
+    ASSERT_EQ(2.0 * i, column.x()[i]);
+    ASSERT_EQ(2.0 * i + 1.0, column.y()[i]);
+  }
+}
+
+TEST_F(GeometryColumnUnitTest, LineStrings) {
+  column.clear(dse::WKB_GEOMETRY_TYPE_LINESTRING);
+
+  // Rows with 0, 5 and 2 points
+  const cass_uint32_t num_points[] = { 0, 5, 2 };
+  std::vector<dse::LineString> line_strings(3);
+  cass_double_t value = 0.0;
+  for (size_t i = 0; i < line_strings.size(); ++i) {
+    for (cass_uint32_t j = 0; j < num_points[i]; ++j) {
+      line_strings[i].add_point(value, -value);
+      value += 1.0;
+    }
+    ASSERT_EQ(CASS_OK, line_strings[i].finish());
+    ASSERT_EQ(CASS_OK, column.append(to_value(line_strings[i].bytes(), DSE_LINE_STRING_TYPE)));
+  }
+
+  // Big-endian when the native byte order is little-endian and vice versa
+  dse::Bytes swapped;
+  swapped.push_back(dse::native_byte_order() == dse::WKB_BYTE_ORDER_LITTLE_ENDIAN
+                    ? dse::WKB_BYTE_ORDER_BIG_ENDIAN : dse::WKB_BYTE_ORDER_LITTLE_ENDIAN);
+  dse::encode_append(dse::swap_uint32(dse::WKB_GEOMETRY_TYPE_LINESTRING), swapped);
+  dse::encode_append(dse::swap_uint32(3), swapped);
+  for (int i = 0; i < 3; ++i) {
+    cass_double_t coordinates[] = { value, -value };
+    for (int j = 0; j < 2; ++j) {
+      cass_uint64_t temp;
+      memcpy(&temp, &coordinates[j], sizeof(cass_uint64_t));
+      dse::encode_append(dse::swap_uint64(temp), swapped);
+    }
+    value += 1.0;
+  }
+  ASSERT_EQ(CASS_OK, column.append(to_value(swapped, DSE_LINE_STRING_TYPE)));
+
+  ASSERT_EQ(4u, column.num_rows());
+  ASSERT_EQ(10u, column.num_points());
+  const size_t expected_offsets[] = { 0, 0, 5, 7, 10 };
+  for (size_t i = 0; i <= column.num_rows(); ++i) {
+    ASSERT_EQ(expected_offsets[i], column.offsets()[i]);
+  }
+  for (size_t i = 0; i < column.num_points(); ++i) {
+    ASSERT_EQ(static_cast<cass_double_t>(i), column.x()[i]);
+    ASSERT_EQ(-static_cast<cass_double_t>(i), column.y()[i]);
+  }
+}
+
+TEST_F(GeometryColumnUnitTest, Invalid) {
+  column.clear(dse::WKB_GEOMETRY_TYPE_LINESTRING);
+
+  dse::LineString line_string;
+  line_string.add_point(0.0, 1.0);
+  line_string.add_point(2.0, 3.0);
+  ASSERT_EQ(CASS_OK, line_string.finish());
+
+  // Truncated points
+  dse::Bytes truncated(line_string.bytes());
+  truncated.resize(truncated.size() - 1);
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA,
+            column.append(to_value(truncated, DSE_LINE_STRING_TYPE)));
+
+  // Wrong geometry type
+  column.clear(dse::WKB_GEOMETRY_TYPE_POINT);
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_DATA,
+            column.append(to_value(line_string.bytes(), DSE_POINT_TYPE)));
+
+  ASSERT_EQ(0u, column.num_rows());
+  ASSERT_EQ(0u, column.num_points());
+}
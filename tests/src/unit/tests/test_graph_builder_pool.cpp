@@ -0,0 +1,108 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "graph_builder_pool.hpp"
+
+#include <string>
+
+class GraphBuilderPoolUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    pool = dse_graph_builder_pool_new(1);
+  }
+
+  void TearDown() {
+    dse_graph_builder_pool_free(pool);
+  }
+
+  DseGraphBuilderPoolStats stats() {
+    DseGraphBuilderPoolStats stats;
+    dse_graph_builder_pool_get_stats(pool, &stats);
+    return stats;
+  }
+
+  DseGraphBuilderPool* pool;
+};
+
+TEST_F(GraphBuilderPoolUnitTest, Recycle) {
+  DseGraphObject* object = dse_graph_builder_pool_get_object(pool);
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_int32(object, "int32", 1));
+  dse_graph_builder_pool_release_object(pool, object);
+
+  // The same object is reused and it's empty
+  ASSERT_EQ(object, dse_graph_builder_pool_get_object(pool));
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_int32(object, "int32", 2));
+  dse_graph_object_finish(object);
+  ASSERT_EQ("{\"int32\":2}", std::string(object->data(), object->length()));
+
+  // Only one object is kept in the pool
+  DseGraphObject* other = dse_graph_builder_pool_get_object(pool);
+  ASSERT_NE(object, other);
+  dse_graph_builder_pool_release_object(pool, object);
+  dse_graph_builder_pool_release_object(pool, other);
+
+  DseGraphArray* array = dse_graph_builder_pool_get_array(pool);
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int32(array, 1));
+  dse_graph_builder_pool_release_array(pool, array);
+  ASSERT_EQ(array, dse_graph_builder_pool_get_array(pool));
+  dse_graph_array_finish(array);
+  ASSERT_EQ("[]", std::string(array->data(), array->length()));
+  dse_graph_builder_pool_release_array(pool, array);
+
+  DseGraphBuilderPoolStats s = stats();
+  EXPECT_EQ(2u, s.hits);
+  EXPECT_EQ(3u, s.misses);
+  EXPECT_EQ(1u, s.discarded);
+  EXPECT_EQ(5u, s.size_classes[0]);
+}
+
+TEST_F(GraphBuilderPoolUnitTest, NestedReleaseRejected) {
+  DseGraphObject* object = dse_graph_builder_pool_get_object(pool);
+  DseGraphObject* nested_object = dse_graph_object_start_object(object, "object");
+  ASSERT_TRUE(nested_object != NULL);
+  dse_graph_object_finish(nested_object);
+  DseGraphArray* nested_array = dse_graph_object_start_array(object, "array");
+  ASSERT_TRUE(nested_array != NULL);
+  dse_graph_array_finish(nested_array);
+
+  // Nested builders are owned by their parent
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_builder_pool_release_object(pool, nested_object));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_builder_pool_release_array(pool, nested_array));
+
+  dse_graph_object_finish(object);
+  ASSERT_EQ("{\"object\":{},\"array\":[]}", std::string(object->data(), object->length()));
+  ASSERT_EQ(CASS_OK, dse_graph_builder_pool_release_object(pool, object));
+
+  DseGraphBuilderPoolStats s = stats();
+  EXPECT_EQ(0u, s.hits);
+  EXPECT_EQ(1u, s.misses);
+  EXPECT_EQ(1u, s.size_classes[0]);
+}
+
+TEST_F(GraphBuilderPoolUnitTest, SizeClasses) {
+  std::string value(1000, 'a');
+  for (int i = 0; i < 2; ++i) {
+    DseGraphObject* object = dse_graph_builder_pool_get_object(pool);
+    ASSERT_EQ(CASS_OK, dse_graph_object_add_string(object, "string", value.c_str()));
+    dse_graph_builder_pool_release_object(pool, object);
+  }
+
+  DseGraphArray* array = dse_graph_builder_pool_get_array(pool);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(CASS_OK, dse_graph_array_add_string(array, value.c_str()));
+  }
+  dse_graph_builder_pool_release_array(pool, array);
+
+  DseGraphBuilderPoolStats s = stats();
+  EXPECT_EQ(0u, s.size_classes[0]);
+  EXPECT_EQ(2u, s.size_classes[1]); // Up to 1 KB
+  EXPECT_EQ(0u, s.size_classes[2]);
+  EXPECT_EQ(1u, s.size_classes[3]); // Up to 16 KB
+}
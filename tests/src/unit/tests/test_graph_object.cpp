@@ -10,6 +10,8 @@
 #include "dse.h"
 #include "graph.hpp"
 
+#include <limits>
+
 class GraphObjectUnitTest : public testing::Test {
 public:
   void SetUp() {
@@ -148,6 +150,35 @@ TEST_F(GraphObjectUnitTest, LineString) {
   ASSERT_EQ(5.0, x); ASSERT_EQ(6.0, y);
 }
 
+TEST_F(GraphObjectUnitTest, LineStringPrecision) {
+  line_string = dse_line_string_new();
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 0.1, -2.2250738585072014e-308));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, -1.7976931348623157e308, 0.012345678901234567));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_line_string(graph_object, "line_string", line_string));
+  dse_graph_object_finish(graph_object);
+
+  ASSERT_EQ("{\"line_string\":\"LINESTRING (0.1 -2.2250738585072014e-308, "
+            "-1.7976931348623157e+308 0.012345678901234567)\"}",
+            std::string(graph_object->data(), graph_object->length()));
+
+  const DseGraphResult* graph_result = to_graph_result();
+  ASSERT_TRUE(graph_result != NULL);
+  const DseGraphResult* value = dse_graph_result_member_value(graph_result, 0);
+
+  cass_double_t x, y;
+  line_string_iterator = dse_line_string_iterator_new();
+  ASSERT_EQ(CASS_OK, dse_graph_result_as_line_string(value, line_string_iterator));
+  ASSERT_EQ(2u, dse_line_string_iterator_num_points(line_string_iterator));
+
+  ASSERT_EQ(CASS_OK, dse_line_string_iterator_next_point(line_string_iterator, &x, &y));
+  ASSERT_EQ(0.1, x); ASSERT_EQ(-2.2250738585072014e-308, y);
+
+  ASSERT_EQ(CASS_OK, dse_line_string_iterator_next_point(line_string_iterator, &x, &y));
+  ASSERT_EQ(-1.7976931348623157e308, x); ASSERT_EQ(0.012345678901234567, y);
+}
+
 TEST_F(GraphObjectUnitTest, Polygon) {
   polygon = dse_polygon_new();
 
@@ -207,3 +238,209 @@ TEST_F(GraphObjectUnitTest, Polygon) {
   ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_point(polygon_iterator, &x, &y));
   ASSERT_EQ(11.0, x); ASSERT_EQ(12.0, y);
 }
+
+TEST_F(GraphObjectUnitTest, NestedScopes) {
+  DseGraphArray* array = dse_graph_object_start_array(graph_object, "array");
+  ASSERT_TRUE(array != NULL);
+
+  // The parent can't be modified while the nested array is open
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_object_add_int32(graph_object, "int32", 1));
+  ASSERT_TRUE(dse_graph_object_start_object(graph_object, "object") == NULL);
+
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int32(array, 1));
+  DseGraphObject* object = dse_graph_array_start_object(array);
+  ASSERT_TRUE(object != NULL);
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_string(object, "string", "abc"));
+  dse_graph_object_finish(object);
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int32(array, 2));
+  dse_graph_array_finish(array);
+
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_int32(graph_object, "int32", 3));
+
+  // Left open to be finished by the parent
+  object = dse_graph_object_start_object(graph_object, "object");
+  ASSERT_TRUE(object != NULL);
+  ASSERT_TRUE(dse_graph_object_start_array(object, "empty") != NULL);
+  dse_graph_object_finish(graph_object);
+
+  ASSERT_EQ("{\"array\":[1,{\"string\":\"abc\"},2],\"int32\":3,\"object\":{\"empty\":[]}}",
+            std::string(graph_object->data(), graph_object->length()));
+
+  const DseGraphResult* graph_result = to_graph_result();
+  ASSERT_TRUE(graph_result != NULL);
+  ASSERT_EQ(3u, dse_graph_result_member_count(graph_result));
+
+  const DseGraphResult* value = dse_graph_result_member_value(graph_result, 0);
+  ASSERT_TRUE(dse_graph_result_is_array(value));
+  ASSERT_EQ(3u, dse_graph_result_element_count(value));
+
+  // Nested scopes are reused after a reset
+  dse_graph_object_reset(graph_object);
+  object = dse_graph_object_start_object(graph_object, "object");
+  ASSERT_TRUE(object != NULL);
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_null(object, "null"));
+  dse_graph_object_finish(graph_object);
+  ASSERT_EQ("{\"object\":{\"null\":null}}",
+            std::string(graph_object->data(), graph_object->length()));
+}
+
+TEST_F(GraphObjectUnitTest, NestedAddRejected) {
+  DseGraphObject* nested_object = dse_graph_object_start_object(graph_object, "object");
+  ASSERT_TRUE(nested_object != NULL);
+  dse_graph_object_finish(nested_object);
+  DseGraphArray* nested_array = dse_graph_object_start_array(graph_object, "array");
+  ASSERT_TRUE(nested_array != NULL);
+  dse_graph_array_finish(nested_array);
+
+  // Nested handles don't have their own buffer so they can't be copied into
+  // another object or array
+  DseGraphObject* object = dse_graph_object_new();
+  DseGraphArray* array = dse_graph_array_new();
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_object_add_object(object, "object", nested_object));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_object_add_object_n(object, "object", 6, nested_object));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_object_add_array(object, "array", nested_array));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_array_add_object(array, nested_object));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_array_add_array(array, nested_array));
+  dse_graph_object_finish(object);
+  dse_graph_array_finish(array);
+  ASSERT_EQ("{}", std::string(object->data(), object->length()));
+  ASSERT_EQ("[]", std::string(array->data(), array->length()));
+  dse_graph_object_free(object);
+  dse_graph_array_free(array);
+
+  dse_graph_object_finish(graph_object);
+  ASSERT_EQ("{\"object\":{},\"array\":[]}",
+            std::string(graph_object->data(), graph_object->length()));
+}
+
+TEST_F(GraphObjectUnitTest, NestedBindRejected) {
+  DseGraphObject* nested_object = dse_graph_object_start_object(graph_object, "object");
+  ASSERT_TRUE(nested_object != NULL);
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_int32(nested_object, "int32", 1));
+  dse_graph_object_finish(graph_object);
+
+  DseGraphStatement* statement = dse_graph_statement_new("g.V()", NULL);
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_statement_bind_values(statement, nested_object));
+  ASSERT_EQ(CASS_OK, dse_graph_statement_bind_values(statement, graph_object));
+  dse_graph_statement_free(statement);
+}
+
+TEST_F(GraphObjectUnitTest, NestedFreeIgnored) {
+  DseGraphObject* nested_object = dse_graph_object_start_object(graph_object, "object");
+  ASSERT_TRUE(nested_object != NULL);
+  dse_graph_object_finish(nested_object);
+  DseGraphArray* nested_array = dse_graph_object_start_array(graph_object, "array");
+  ASSERT_TRUE(nested_array != NULL);
+
+  // The parent still owns them and they're reused by later calls
+  dse_graph_object_free(nested_object);
+  dse_graph_array_free(nested_array);
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int32(nested_array, 1));
+  dse_graph_array_finish(nested_array);
+  ASSERT_EQ(nested_object, dse_graph_object_start_object(graph_object, "other"));
+  dse_graph_object_finish(graph_object);
+
+  ASSERT_EQ("{\"object\":{},\"array\":[1],\"other\":{}}",
+            std::string(graph_object->data(), graph_object->length()));
+}
+
+TEST_F(GraphObjectUnitTest, Template) {
+  DseGraphObjectTemplate* object_template = dse_graph_object_template_new();
+  ASSERT_EQ(CASS_OK, dse_graph_object_template_add_name(object_template, "name"));
+  ASSERT_EQ(CASS_OK, dse_graph_object_template_add_name(object_template, "age"));
+  ASSERT_EQ(CASS_OK, dse_graph_object_template_add_name(object_template, "location"));
+  ASSERT_EQ(CASS_OK, dse_graph_object_template_add_name(object_template, "\"quoted\""));
+  ASSERT_EQ(4u, dse_graph_object_template_name_count(object_template));
+
+  for (int i = 0; i < 2; ++i) {
+    dse_graph_object_reset(graph_object);
+    ASSERT_EQ(CASS_OK, dse_graph_object_add_string_by_index(graph_object, object_template, 0, "abc"));
+    ASSERT_EQ(CASS_OK, dse_graph_object_add_int32_by_index(graph_object, object_template, 1, 42));
+    ASSERT_EQ(CASS_OK, dse_graph_object_add_point_by_index(graph_object, object_template, 2, 1.0, 2.0));
+    ASSERT_EQ(CASS_OK, dse_graph_object_add_null_by_index(graph_object, object_template, 3));
+    ASSERT_EQ(CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS,
+              dse_graph_object_add_null_by_index(graph_object, object_template, 4));
+    dse_graph_object_finish(graph_object);
+
+    ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS,
+              dse_graph_object_add_null_by_index(graph_object, object_template, 0));
+    ASSERT_EQ("{\"name\":\"abc\",\"age\":42,\"location\":\"POINT (1 2)\",\"\\\"quoted\\\"\":null}",
+              std::string(graph_object->data(), graph_object->length()));
+  }
+
+  const DseGraphResult* graph_result = to_graph_result();
+  ASSERT_TRUE(graph_result != NULL);
+  ASSERT_EQ(4u, dse_graph_result_member_count(graph_result));
+  ASSERT_EQ("\"quoted\"", std::string(dse_graph_result_member_key(graph_result, 3, NULL)));
+
+  dse_graph_object_template_free(object_template);
+}
+
+TEST_F(GraphObjectUnitTest, ArrayOfNumbers) {
+  const cass_int64_t int64s[] = { 0, -1, 9223372036854775807LL, -9223372036854775807LL - 1 };
+  const cass_double_t doubles[] = { 0.0, -1.5, 0.1, 1e300 };
+  const cass_double_t invalid[] = { 1.0, std::numeric_limits<cass_double_t>::infinity() };
+
+  DseGraphArray* array = dse_graph_array_new();
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int32(array, 1));
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int64_n(array, int64s, 4));
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int64_n(array, int64s, 0));
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_double_n(array, doubles, 4));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_array_add_double_n(array, invalid, 2));
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int32(array, 2));
+  dse_graph_array_finish(array);
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_graph_array_add_int64_n(array, int64s, 4));
+
+  ASSERT_EQ(CASS_OK, dse_graph_object_add_array(graph_object, "array", array));
+  dse_graph_array_free(array);
+  dse_graph_object_finish(graph_object);
+
+  const DseGraphResult* graph_result = to_graph_result();
+  ASSERT_TRUE(graph_result != NULL);
+  const DseGraphResult* value = dse_graph_result_member_value(graph_result, 0);
+  ASSERT_TRUE(dse_graph_result_is_array(value));
+  ASSERT_EQ(10u, dse_graph_result_element_count(value));
+
+  for (size_t i = 0; i < 4; ++i) {
+    const DseGraphResult* element = dse_graph_result_element(value, 1 + i);
+    ASSERT_EQ(int64s[i], dse_graph_result_get_int64(element));
+  }
+
+  for (size_t i = 0; i < 4; ++i) {
+    const DseGraphResult* element = dse_graph_result_element(value, 5 + i);
+    ASSERT_TRUE(dse_graph_result_is_double(element));
+    ASSERT_EQ(doubles[i], dse_graph_result_get_double(element));
+  }
+
+  ASSERT_EQ(2, dse_graph_result_get_int32(dse_graph_result_element(value, 9)));
+
+  // The text is the same as adding the values one at a time including
+  // exponents and values without a fraction
+  const cass_double_t formatted[] = { 0.0, -0.0, 1.0, -1.5, 0.1, 1e21, 1e22, 1e-5, 1e-7,
+                                      123456789012.5, 1.7976931348623157e308, 5e-324 };
+  const size_t num_formatted = sizeof(formatted) / sizeof(formatted[0]);
+
+  DseGraphArray* bulk = dse_graph_array_new();
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_int64_n(bulk, int64s, 4));
+  ASSERT_EQ(CASS_OK, dse_graph_array_add_double_n(bulk, formatted, num_formatted));
+  dse_graph_array_finish(bulk);
+
+  DseGraphArray* single = dse_graph_array_new();
+  for (size_t i = 0; i < 4; ++i) {
+    ASSERT_EQ(CASS_OK, dse_graph_array_add_int64(single, int64s[i]));
+  }
+  for (size_t i = 0; i < num_formatted; ++i) {
+    ASSERT_EQ(CASS_OK, dse_graph_array_add_double(single, formatted[i]));
+  }
+  dse_graph_array_finish(single);
+
+  ASSERT_EQ(std::string(single->data(), single->length()),
+            std::string(bulk->data(), bulk->length()));
+  ASSERT_EQ("[0,-1,9223372036854775807,-9223372036854775808,"
+            "0.0,-0.0,1.0,-1.5,0.1,1e21,1e22,0.00001,1e-7,"
+            "123456789012.5,1.7976931348623157e308,5e-324]",
+            std::string(bulk->data(), bulk->length()));
+
+  dse_graph_array_free(bulk);
+  dse_graph_array_free(single);
+}
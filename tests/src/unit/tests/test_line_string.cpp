@@ -68,6 +68,81 @@ TEST_F(LineStringUnitTest, BinaryMultiple) {
   ASSERT_EQ(4.0, x); ASSERT_EQ(5.0, y);
 }
 
+TEST_F(LineStringUnitTest, BinaryBulk) {
+  const cass_double_t points[] = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+  const cass_double_t xs[] = { 6.0, 8.0, 10.0 };
+  const cass_double_t ys[] = { 7.0, 9.0, 11.0 };
+  ASSERT_EQ(CASS_OK, dse_line_string_add_points_n(line_string, points, 3));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_points_xy_n(line_string, xs, ys, 3));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(6u, iterator.num_points());
+
+  cass_double_t x, y;
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+    ASSERT_EQ(2.0 * i, x); ASSERT_EQ(2.0 * i + 1.0, y);
+  }
+}
+
+TEST_F(LineStringUnitTest, BinaryPoints) {
+  const cass_double_t points[] = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+  ASSERT_EQ(CASS_OK, dse_line_string_add_points_n(line_string, points, 3));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+
+  const cass_byte_t* in_place;
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_OK, iterator.next_points(&in_place, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    cass_double_t coordinate;
+    memcpy(&coordinate, in_place + i * sizeof(cass_double_t), sizeof(cass_double_t));
+    ASSERT_EQ(points[i], coordinate);
+  }
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_point(&x, &y));
+}
+
+TEST_F(LineStringUnitTest, BinaryPointsSwapped) {
+  // Big-endian when the native byte order is little-endian and vice versa
+  const cass_double_t points[] = { 0.5, 1.5, 2.5, 3.5, 4.5, 5.5 };
+  dse::Bytes bytes;
+  bytes.push_back(dse::native_byte_order() == dse::WKB_BYTE_ORDER_LITTLE_ENDIAN
+                  ? dse::WKB_BYTE_ORDER_BIG_ENDIAN : dse::WKB_BYTE_ORDER_LITTLE_ENDIAN);
+  dse::encode_append(dse::swap_uint32(dse::WKB_GEOMETRY_TYPE_LINESTRING), bytes);
+  dse::encode_append(dse::swap_uint32(3), bytes);
+  for (int i = 0; i < 6; ++i) {
+    cass_uint64_t temp;
+    memcpy(&temp, &points[i], sizeof(cass_uint64_t));
+    dse::encode_append(dse::swap_uint64(temp), bytes);
+  }
+
+  value = cass::Value(0, // Not used
+                      cass::DataType::ConstPtr(new cass::CustomType(DSE_LINE_STRING_TYPE)),
+                      reinterpret_cast<char*>(&bytes[0]), bytes.size());
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(CassValue::to(&value)));
+  ASSERT_EQ(3u, iterator.num_points());
+
+  const cass_byte_t* in_place;
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_IMPLEMENTED, iterator.next_points(&in_place, &num_points));
+
+  cass_double_t output[6];
+  ASSERT_EQ(CASS_OK, iterator.next_points_copy(output, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(points[i], output[i]);
+  }
+}
+
 TEST_F(LineStringUnitTest, TextEmpty) {
   std::string wkt = line_string->to_wkt();
   ASSERT_EQ("LINESTRING ()", wkt);
@@ -129,3 +204,197 @@ TEST_F(LineStringUnitTest, TextPrecision) {
   ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
   ASSERT_EQ(0.0001, x); ASSERT_EQ(0.012345678901234567, y);
 }
+
+TEST_F(LineStringUnitTest, TextMaxSize) {
+  // Longest possible numbers
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, -2.2250738585072014e-308, -1.7976931348623157e308));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, -2.2250738585072014e-308, -1.7976931348623157e308));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+
+  std::vector<char> data(WKT_MAX_SIZE(line_string->bytes().size()));
+  dse::WktFixedBuffer buffer(&data[0]);
+  dse::WktWriter<dse::WktFixedBuffer> writer(buffer);
+  line_string->to_wkt(writer);
+
+  std::string wkt = line_string->to_wkt();
+  ASSERT_EQ(wkt, std::string(&data[0], buffer.size()));
+  ASSERT_LE(wkt.size(), data.size());
+}
+
+TEST_F(LineStringUnitTest, TextPointsCopy) {
+  std::string wkt("LINESTRING (0 1, 2 3, 4 5)");
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+
+  cass_double_t output[6];
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_OK, iterator.next_points_copy(output, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(static_cast<cass_double_t>(i), output[i]);
+  }
+}
+
+TEST_F(LineStringUnitTest, TextInvalid) {
+  const char* wkt = "LINESTRING (0 1, 2)";
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, iterator.reset_text(wkt, strlen(wkt)));
+  ASSERT_EQ(0u, iterator.num_points());
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_point(&x, &y));
+}
+
+TEST_F(LineStringUnitTest, FromWkt) {
+  ASSERT_EQ(CASS_OK, dse_line_string_from_wkt(line_string, "LINESTRING (0 1, 2 3, 4.5 -5.5)"));
+  ASSERT_EQ(WKB_LINE_STRING_HEADER_SIZE + 6 * sizeof(cass_double_t),
+            line_string->bytes().size());
+  ASSERT_EQ(line_string->bytes().size(), line_string->bytes().capacity());
+
+  DseLineString* expected = dse_line_string_new();
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(expected, 0.0, 1.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(expected, 2.0, 3.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(expected, 4.5, -5.5));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(expected));
+  ASSERT_EQ(expected->bytes(), line_string->bytes());
+  dse_line_string_free(expected);
+
+  // Builders can be extended after parsing
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 6.0, 7.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+  ASSERT_EQ("LINESTRING (0 1, 2 3, 4.5 -5.5, 6 7)", line_string->to_wkt());
+}
+
+TEST_F(LineStringUnitTest, FromWktInvalid) {
+  const char* wkt = "POLYGON ((0 1, 2 3, 4 5))";
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_line_string_from_wkt_n(line_string, wkt, strlen(wkt)));
+  ASSERT_EQ("LINESTRING ()", line_string->to_wkt());
+}
+
+TEST_F(LineStringUnitTest, BinaryDataType) {
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 0.0, 1.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 2.0, 3.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+  char* data = const_cast<char*>(reinterpret_cast<const char*>(line_string->bytes().data()));
+
+  // Values from the same column share a data type
+  cass::DataType::ConstPtr data_type(new cass::CustomType(DSE_LINE_STRING_TYPE));
+  cass::Value first(0, data_type, data, line_string->bytes().size());
+  cass::Value second(0, data_type, data, line_string->bytes().size());
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(CassValue::to(&first)));
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(CassValue::to(&second)));
+
+  cass::Value other(0,
+                    cass::DataType::ConstPtr(new cass::CustomType(DSE_POLYGON_TYPE)),
+                    data, line_string->bytes().size());
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_CUSTOM_TYPE, iterator.reset_binary(CassValue::to(&other)));
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+}
+
+TEST_F(LineStringUnitTest, InitStorage) {
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 0.0, 1.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 2.0, 3.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+
+  DseLineStringIteratorStorage storage;
+  DseLineStringIterator* iterator = dse_line_string_iterator_init(&storage);
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_line_string_iterator_next_point(iterator, &x, &y));
+
+  ASSERT_EQ(CASS_OK, dse_line_string_iterator_reset(iterator, to_value()));
+  ASSERT_EQ(2u, dse_line_string_iterator_num_points(iterator));
+  ASSERT_EQ(CASS_OK, dse_line_string_iterator_next_point(iterator, &x, &y));
+  ASSERT_EQ(0.0, x); ASSERT_EQ(1.0, y);
+  ASSERT_EQ(CASS_OK, dse_line_string_iterator_next_point(iterator, &x, &y));
+  ASSERT_EQ(2.0, x); ASSERT_EQ(3.0, y);
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_line_string_iterator_next_point(iterator, &x, &y));
+
+  dse_line_string_iterator_destroy(iterator);
+}
+
+TEST_F(LineStringUnitTest, Envelope) {
+  cass_double_t min_x, min_y, max_x, max_y;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE,
+            dse_line_string_envelope(line_string, &min_x, &min_y, &max_x, &max_y));
+
+  const cass_double_t points[] = { 0.0, 1.0, -2.0, 3.0, 4.0, -5.0, 1.0, 1.0, 0.5, 9.0 };
+  ASSERT_EQ(CASS_OK, dse_line_string_add_point(line_string, 1.0, -1.0));
+  ASSERT_EQ(CASS_OK, dse_line_string_add_points_n(line_string, points, 5));
+  ASSERT_EQ(CASS_OK, dse_line_string_finish(line_string));
+
+  ASSERT_EQ(CASS_OK, dse_line_string_envelope(line_string, &min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(-2.0, min_x); ASSERT_EQ(-5.0, min_y);
+  ASSERT_EQ(4.0, max_x); ASSERT_EQ(9.0, max_y);
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.envelope(&min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  min_x = min_y = max_x = max_y = 0.0;
+  ASSERT_EQ(CASS_OK, iterator.envelope(&min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(-2.0, min_x); ASSERT_EQ(-5.0, min_y);
+  ASSERT_EQ(4.0, max_x); ASSERT_EQ(9.0, max_y);
+
+  ASSERT_EQ(CASS_OK, dse_line_string_from_wkt(line_string, "LINESTRING (7 8, 6 10)"));
+  ASSERT_EQ(CASS_OK, dse_line_string_envelope(line_string, &min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(6.0, min_x); ASSERT_EQ(8.0, min_y);
+  ASSERT_EQ(7.0, max_x); ASSERT_EQ(10.0, max_y);
+
+  dse_line_string_reset(line_string);
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE,
+            dse_line_string_envelope(line_string, &min_x, &min_y, &max_x, &max_y));
+}
+
+TEST_F(LineStringUnitTest, EnvelopeSwapped) {
+  const cass_double_t points[] = { 0.5, 1.5, -2.5, 3.5, 4.5, -5.5 };
+  dse::Bytes bytes;
+  bytes.push_back(dse::native_byte_order() == dse::WKB_BYTE_ORDER_LITTLE_ENDIAN
+                  ? dse::WKB_BYTE_ORDER_BIG_ENDIAN : dse::WKB_BYTE_ORDER_LITTLE_ENDIAN);
+  dse::encode_append(dse::swap_uint32(dse::WKB_GEOMETRY_TYPE_LINESTRING), bytes);
+  dse::encode_append(dse::swap_uint32(3), bytes);
+  for (int i = 0; i < 6; ++i) {
+    cass_uint64_t temp;
+    memcpy(&temp, &points[i], sizeof(cass_uint64_t));
+    dse::encode_append(dse::swap_uint64(temp), bytes);
+  }
+
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(&bytes[0], bytes.size()));
+
+  cass_double_t min_x, min_y, max_x, max_y;
+  ASSERT_EQ(CASS_OK, iterator.envelope(&min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(-2.5, min_x); ASSERT_EQ(-5.5, min_y);
+  ASSERT_EQ(4.5, max_x); ASSERT_EQ(3.5, max_y);
+}
+
+TEST_F(LineStringUnitTest, Simplify) {
+  // A trace with collinear points and a small amount of noise
+  ASSERT_EQ(CASS_OK, dse_line_string_from_wkt(line_string,
+                                              "LINESTRING (0 0, 1 0, 2 0.05, 3 0, 4 0, "
+                                              "4 1, 4 2, 4 3, 5 3)"));
+  ASSERT_EQ(CASS_OK, dse_line_string_simplify(line_string, 0.0));
+  ASSERT_EQ("LINESTRING (0 0, 1 0, 2 0.05, 3 0, 4 0, 4 3, 5 3)", line_string->to_wkt());
+
+  ASSERT_EQ(CASS_OK, dse_line_string_simplify(line_string, 0.1));
+  ASSERT_EQ("LINESTRING (0 0, 4 0, 4 3, 5 3)", line_string->to_wkt());
+  ASSERT_EQ(WKB_LINE_STRING_HEADER_SIZE + 8 * sizeof(cass_double_t), line_string->bytes().size());
+
+  cass_double_t min_x, min_y, max_x, max_y;
+  ASSERT_EQ(CASS_OK, dse_line_string_envelope(line_string, &min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(0.0, min_x); ASSERT_EQ(0.0, min_y);
+  ASSERT_EQ(5.0, max_x); ASSERT_EQ(3.0, max_y);
+
+  // The simplified line string can still be read
+  dse::LineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(4u, iterator.num_points());
+
+  ASSERT_EQ(CASS_OK, dse_line_string_simplify(line_string, 10.0));
+  ASSERT_EQ("LINESTRING (0 0, 5 3)", line_string->to_wkt());
+
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_line_string_simplify(line_string, -1.0));
+}
@@ -0,0 +1,117 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "multi_line_string.hpp"
+
+#include <value.hpp>
+
+class MultiLineStringUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    multi_line_string = dse_multi_line_string_new();
+  }
+
+  void TearDown() {
+    dse_multi_line_string_free(multi_line_string);
+  }
+
+  const CassValue* to_value() {
+    char* data = const_cast<char*>(reinterpret_cast<const char*>(multi_line_string->bytes().data()));
+    value =  cass::Value(0, // Not used
+                         cass::DataType::ConstPtr(new cass::CustomType(DSE_MULTI_LINE_STRING_TYPE)),
+                         data, multi_line_string->bytes().size());
+    return CassValue::to(&value);
+  }
+
+  void build() {
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_start_line_string(multi_line_string));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_add_point(multi_line_string, 0, 1));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_add_point(multi_line_string, 2, 3));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_start_line_string(multi_line_string));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_add_point(multi_line_string, 4, 5));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_add_point(multi_line_string, 6, 7));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_add_point(multi_line_string, 8, 9));
+    ASSERT_EQ(CASS_OK, dse_multi_line_string_finish(multi_line_string));
+  }
+
+  void verify(dse::MultiLineStringIterator& iterator) {
+    ASSERT_EQ(2u, iterator.num_line_strings());
+
+    dse::LineStringIterator line_string;
+    cass_double_t x, y;
+
+    ASSERT_EQ(CASS_OK, iterator.next_line_string(&line_string));
+    ASSERT_EQ(2u, line_string.num_points());
+    ASSERT_EQ(CASS_OK, line_string.next_point(&x, &y));
+    ASSERT_EQ(0.0, x); ASSERT_EQ(1.0, y);
+    ASSERT_EQ(CASS_OK, line_string.next_point(&x, &y));
+    ASSERT_EQ(2.0, x); ASSERT_EQ(3.0, y);
+
+    ASSERT_EQ(CASS_OK, iterator.next_line_string(&line_string));
+    ASSERT_EQ(3u, line_string.num_points());
+    ASSERT_EQ(CASS_OK, line_string.next_point(&x, &y));
+    ASSERT_EQ(4.0, x); ASSERT_EQ(5.0, y);
+    ASSERT_EQ(CASS_OK, line_string.next_point(&x, &y));
+    ASSERT_EQ(6.0, x); ASSERT_EQ(7.0, y);
+    ASSERT_EQ(CASS_OK, line_string.next_point(&x, &y));
+    ASSERT_EQ(8.0, x); ASSERT_EQ(9.0, y);
+
+    ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_line_string(&line_string));
+  }
+
+  DseMultiLineString* multi_line_string;
+  cass::Value value;
+};
+
+TEST_F(MultiLineStringUnitTest, BinaryEmpty) {
+  ASSERT_EQ(CASS_OK, dse_multi_line_string_finish(multi_line_string));
+
+  dse::MultiLineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(0u, iterator.num_line_strings());
+}
+
+TEST_F(MultiLineStringUnitTest, BinaryMultiple) {
+  build();
+
+  dse::MultiLineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  verify(iterator);
+}
+
+TEST_F(MultiLineStringUnitTest, BinaryInvalidState) {
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_multi_line_string_add_point(multi_line_string, 0, 1));
+
+  ASSERT_EQ(CASS_OK, dse_multi_line_string_start_line_string(multi_line_string));
+  ASSERT_EQ(CASS_OK, dse_multi_line_string_add_point(multi_line_string, 0, 1));
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_multi_line_string_finish(multi_line_string));
+}
+
+TEST_F(MultiLineStringUnitTest, TextEmpty) {
+  ASSERT_EQ(CASS_OK, dse_multi_line_string_finish(multi_line_string));
+
+  std::string wkt = multi_line_string->to_wkt();
+  ASSERT_EQ("MULTILINESTRING ()", wkt);
+
+  dse::MultiLineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  ASSERT_EQ(0u, iterator.num_line_strings());
+}
+
+TEST_F(MultiLineStringUnitTest, TextMultiple) {
+  build();
+
+  std::string wkt = multi_line_string->to_wkt();
+  ASSERT_EQ("MULTILINESTRING ((0 1, 2 3), (4 5, 6 7, 8 9))", wkt);
+
+  dse::MultiLineStringIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  verify(iterator);
+}
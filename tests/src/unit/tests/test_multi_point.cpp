@@ -0,0 +1,125 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "multi_point.hpp"
+
+#include <value.hpp>
+
+class MultiPointUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    multi_point = dse_multi_point_new();
+  }
+
+  void TearDown() {
+    dse_multi_point_free(multi_point);
+  }
+
+  const CassValue* to_value() {
+    char* data = const_cast<char*>(reinterpret_cast<const char*>(multi_point->bytes().data()));
+    value =  cass::Value(0, // Not used
+                         cass::DataType::ConstPtr(new cass::CustomType(DSE_MULTI_POINT_TYPE)),
+                         data, multi_point->bytes().size());
+    return CassValue::to(&value);
+  }
+
+  DseMultiPoint* multi_point;
+  cass::Value value;
+};
+
+TEST_F(MultiPointUnitTest, BinaryEmpty) {
+  ASSERT_EQ(CASS_OK, dse_multi_point_finish(multi_point));
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(0u, iterator.num_points());
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_point(&x, &y));
+}
+
+TEST_F(MultiPointUnitTest, BinaryMultiple) {
+  ASSERT_EQ(CASS_OK, dse_multi_point_add_point(multi_point, 0, 1));
+  ASSERT_EQ(CASS_OK, dse_multi_point_add_point(multi_point, 2, 3));
+  ASSERT_EQ(CASS_OK, dse_multi_point_finish(multi_point));
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(2u, iterator.num_points());
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+  ASSERT_EQ(0.0, x); ASSERT_EQ(1.0, y);
+  ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+  ASSERT_EQ(2.0, x); ASSERT_EQ(3.0, y);
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_point(&x, &y));
+}
+
+TEST_F(MultiPointUnitTest, BinaryTruncated) {
+  ASSERT_EQ(CASS_OK, dse_multi_point_add_point(multi_point, 0, 1));
+  ASSERT_EQ(CASS_OK, dse_multi_point_finish(multi_point));
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA,
+            iterator.reset_binary(multi_point->bytes().data(),
+                                  multi_point->bytes().size() - 1));
+}
+
+TEST_F(MultiPointUnitTest, TextEmpty) {
+  ASSERT_EQ(CASS_OK, dse_multi_point_finish(multi_point));
+
+  std::string wkt = multi_point->to_wkt();
+  ASSERT_EQ("MULTIPOINT ()", wkt);
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  ASSERT_EQ(0u, iterator.num_points());
+}
+
+TEST_F(MultiPointUnitTest, TextMultiple) {
+  ASSERT_EQ(CASS_OK, dse_multi_point_add_point(multi_point, 0, 1));
+  ASSERT_EQ(CASS_OK, dse_multi_point_add_point(multi_point, 2, 3));
+  ASSERT_EQ(CASS_OK, dse_multi_point_finish(multi_point));
+
+  std::string wkt = multi_point->to_wkt();
+  ASSERT_EQ("MULTIPOINT ((0 1), (2 3))", wkt);
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  ASSERT_EQ(2u, iterator.num_points());
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+  ASSERT_EQ(0.0, x); ASSERT_EQ(1.0, y);
+  ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+  ASSERT_EQ(2.0, x); ASSERT_EQ(3.0, y);
+}
+
+TEST_F(MultiPointUnitTest, TextUnparenthesizedPoints) {
+  const char* wkt = "MULTIPOINT (0 1, 2 3)";
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt, strlen(wkt)));
+  ASSERT_EQ(2u, iterator.num_points());
+
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+  ASSERT_EQ(0.0, x); ASSERT_EQ(1.0, y);
+  ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+  ASSERT_EQ(2.0, x); ASSERT_EQ(3.0, y);
+}
+
+TEST_F(MultiPointUnitTest, TextInvalid) {
+  const char* wkt = "MULTIPOINT ((0 1), (2))";
+
+  dse::MultiPointIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, iterator.reset_text(wkt, strlen(wkt)));
+  ASSERT_EQ(0u, iterator.num_points());
+}
@@ -0,0 +1,117 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "multi_polygon.hpp"
+
+#include <value.hpp>
+
+class MultiPolygonUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    multi_polygon = dse_multi_polygon_new();
+  }
+
+  void TearDown() {
+    dse_multi_polygon_free(multi_polygon);
+  }
+
+  const CassValue* to_value() {
+    char* data = const_cast<char*>(reinterpret_cast<const char*>(multi_polygon->bytes().data()));
+    value =  cass::Value(0, // Not used
+                         cass::DataType::ConstPtr(new cass::CustomType(DSE_MULTI_POLYGON_TYPE)),
+                         data, multi_polygon->bytes().size());
+    return CassValue::to(&value);
+  }
+
+  void build() {
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_start_polygon(multi_polygon));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_start_ring(multi_polygon));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 0, 1));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 2, 3));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 4, 5));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_start_ring(multi_polygon));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 6, 7));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 8, 9));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 10, 11));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_start_polygon(multi_polygon));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_start_ring(multi_polygon));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 12, 13));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 14, 15));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_add_point(multi_polygon, 16, 17));
+    ASSERT_EQ(CASS_OK, dse_multi_polygon_finish(multi_polygon));
+  }
+
+  void verify(dse::MultiPolygonIterator& iterator) {
+    ASSERT_EQ(2u, iterator.num_polygons());
+
+    dse::PolygonIterator polygon;
+    cass_uint32_t num_points;
+    cass_double_t x, y;
+
+    ASSERT_EQ(CASS_OK, iterator.next_polygon(&polygon));
+    ASSERT_EQ(2u, polygon.num_rings());
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_EQ(CASS_OK, polygon.next_num_points(&num_points));
+      ASSERT_EQ(3u, num_points);
+      for (int j = 0; j < 3; ++j) {
+        ASSERT_EQ(CASS_OK, polygon.next_point(&x, &y));
+        ASSERT_EQ(static_cast<cass_double_t>(6 * i + 2 * j), x);
+        ASSERT_EQ(static_cast<cass_double_t>(6 * i + 2 * j + 1), y);
+      }
+    }
+
+    ASSERT_EQ(CASS_OK, iterator.next_polygon(&polygon));
+    ASSERT_EQ(1u, polygon.num_rings());
+    ASSERT_EQ(CASS_OK, polygon.next_num_points(&num_points));
+    ASSERT_EQ(3u, num_points);
+    ASSERT_EQ(CASS_OK, polygon.next_point(&x, &y));
+    ASSERT_EQ(12.0, x); ASSERT_EQ(13.0, y);
+
+    ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_polygon(&polygon));
+  }
+
+  DseMultiPolygon* multi_polygon;
+  cass::Value value;
+};
+
+TEST_F(MultiPolygonUnitTest, BinaryEmpty) {
+  ASSERT_EQ(CASS_OK, dse_multi_polygon_finish(multi_polygon));
+
+  dse::MultiPolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(0u, iterator.num_polygons());
+}
+
+TEST_F(MultiPolygonUnitTest, BinaryMultiple) {
+  build();
+
+  dse::MultiPolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  verify(iterator);
+}
+
+TEST_F(MultiPolygonUnitTest, BinaryInvalidState) {
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_multi_polygon_start_ring(multi_polygon));
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_multi_polygon_add_point(multi_polygon, 0, 1));
+
+  ASSERT_EQ(CASS_OK, dse_multi_polygon_start_polygon(multi_polygon));
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_multi_polygon_finish(multi_polygon));
+}
+
+TEST_F(MultiPolygonUnitTest, TextMultiple) {
+  build();
+
+  std::string wkt = multi_polygon->to_wkt();
+  ASSERT_EQ("MULTIPOLYGON (((0 1, 2 3, 4 5), (6 7, 8 9, 10 11)), ((12 13, 14 15, 16 17)))", wkt);
+
+  dse::MultiPolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  verify(iterator);
+}
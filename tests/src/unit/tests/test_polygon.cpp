@@ -119,6 +119,76 @@ TEST_F(PolygonUnitTest, BinaryMultipleRings) {
   ASSERT_EQ(12.0, x); ASSERT_EQ(13.0, y);
 }
 
+TEST_F(PolygonUnitTest, BinaryBulk) {
+  const cass_double_t points[] = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+  const cass_double_t xs[] = { 6.0, 8.0, 10.0 };
+  const cass_double_t ys[] = { 7.0, 9.0, 11.0 };
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_points_n(polygon, points, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_points_xy_n(polygon, xs, ys, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(2u, iterator.num_rings());
+
+  cass_uint32_t num_points;
+  cass_double_t x, y;
+  for (int i = 0; i < 6; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+      ASSERT_EQ(3u, num_points);
+    }
+    ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
+    ASSERT_EQ(2.0 * i, x); ASSERT_EQ(2.0 * i + 1.0, y);
+  }
+}
+
+TEST_F(PolygonUnitTest, BinaryPoints) {
+  const cass_double_t points[] = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_points_n(polygon, points, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_points_n(polygon, points, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(3u, iterator.num_rings());
+
+  const cass_byte_t* in_place;
+  cass_double_t output[6];
+  cass_uint32_t num_points;
+
+  // First ring
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(3u, num_points);
+  ASSERT_EQ(CASS_OK, iterator.next_points(&in_place, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    cass_double_t coordinate;
+    memcpy(&coordinate, in_place + i * sizeof(cass_double_t), sizeof(cass_double_t));
+    ASSERT_EQ(points[i], coordinate);
+  }
+
+  // Empty ring
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(0u, num_points);
+
+  // Last ring
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(3u, num_points);
+  ASSERT_EQ(CASS_OK, iterator.next_points_copy(output, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(points[i], output[i]);
+  }
+
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_num_points(&num_points));
+}
+
 TEST_F(PolygonUnitTest, TextEmpty) {
   std::string wkt = polygon->to_wkt();
   ASSERT_EQ("POLYGON ()", wkt);
@@ -221,3 +291,300 @@ TEST_F(PolygonUnitTest, TextMultipleRings) {
   ASSERT_EQ(CASS_OK, iterator.next_point(&x, &y));
   ASSERT_EQ(12.0, x); ASSERT_EQ(13.0, y);
 }
+
+TEST_F(PolygonUnitTest, TextPointsCopy) {
+  std::string wkt("POLYGON ((0 1, 2 3, 4 5), (), (6 7, 8 9, 10 11))");
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_text(wkt.data(), wkt.size()));
+  ASSERT_EQ(3u, iterator.num_rings());
+
+  cass_double_t output[6];
+  cass_uint32_t num_points;
+
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(3u, num_points);
+  ASSERT_EQ(CASS_OK, iterator.next_points_copy(output, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(static_cast<cass_double_t>(i), output[i]);
+  }
+
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(0u, num_points);
+
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(3u, num_points);
+  ASSERT_EQ(CASS_OK, iterator.next_points_copy(output, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(static_cast<cass_double_t>(i + 6), output[i]);
+  }
+}
+
+TEST_F(PolygonUnitTest, TextInvalid) {
+  const char* wkt = "POLYGON ((0 1, 2 3, 4 5), 6 7)";
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, iterator.reset_text(wkt, strlen(wkt)));
+  ASSERT_EQ(0u, iterator.num_rings());
+
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.next_num_points(&num_points));
+}
+
+TEST_F(PolygonUnitTest, FromWkt) {
+  ASSERT_EQ(CASS_OK, dse_polygon_from_wkt(polygon, "POLYGON ((0 1, 2 3, 4 5), (6 7, 8 9, 10 11, 12 13))"));
+  ASSERT_EQ(polygon->bytes().size(), polygon->bytes().capacity());
+
+  DsePolygon* expected = dse_polygon_new();
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(expected));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(CASS_OK, dse_polygon_add_point(expected, 2 * i, 2 * i + 1));
+  }
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(expected));
+  for (int i = 3; i < 7; ++i) {
+    ASSERT_EQ(CASS_OK, dse_polygon_add_point(expected, 2 * i, 2 * i + 1));
+  }
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(expected));
+  ASSERT_EQ(expected->bytes(), polygon->bytes());
+  dse_polygon_free(expected);
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(2u, iterator.num_rings());
+}
+
+TEST_F(PolygonUnitTest, FromWktInvalid) {
+  const char* wkt = "POLYGON ((0 1, 2 3, 4 5)";
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_polygon_from_wkt_n(polygon, wkt, strlen(wkt)));
+  ASSERT_EQ("POLYGON ()", polygon->to_wkt());
+}
+
+TEST_F(PolygonUnitTest, InitStorage) {
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 0, 1));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 2, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 4, 5));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  DsePolygonIteratorStorage storage;
+  DsePolygonIterator* iterator = dse_polygon_iterator_init(&storage);
+
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_polygon_iterator_next_num_points(iterator, &num_points));
+
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_reset(iterator, to_value()));
+  ASSERT_EQ(1u, dse_polygon_iterator_num_rings(iterator));
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_num_points(iterator, &num_points));
+  ASSERT_EQ(3u, num_points);
+
+  cass_double_t x, y;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_point(iterator, &x, &y));
+    ASSERT_EQ(2.0 * i, x); ASSERT_EQ(2.0 * i + 1.0, y);
+  }
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_polygon_iterator_next_point(iterator, &x, &y));
+
+  dse_polygon_iterator_destroy(iterator);
+}
+
+TEST_F(PolygonUnitTest, Envelope) {
+  cass_double_t min_x, min_y, max_x, max_y;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE,
+            dse_polygon_envelope(polygon, &min_x, &min_y, &max_x, &max_y));
+
+  const cass_double_t xs[] = { 0.0, 10.0, 10.0, 0.0 };
+  const cass_double_t ys[] = { 0.0, 0.0, 10.0, 0.0 };
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_points_xy_n(polygon, xs, ys, 4));
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, -1.0, 2.0));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 3.0, 12.0));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 1.0, 1.0));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, -1.0, 2.0));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  ASSERT_EQ(CASS_OK, dse_polygon_envelope(polygon, &min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(-1.0, min_x); ASSERT_EQ(0.0, min_y);
+  ASSERT_EQ(10.0, max_x); ASSERT_EQ(12.0, max_y);
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.envelope(&min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  min_x = min_y = max_x = max_y = 0.0;
+  ASSERT_EQ(CASS_OK, iterator.envelope(&min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(-1.0, min_x); ASSERT_EQ(0.0, min_y);
+  ASSERT_EQ(10.0, max_x); ASSERT_EQ(12.0, max_y);
+
+  ASSERT_EQ(CASS_OK, dse_polygon_from_wkt(polygon, "POLYGON ((1 2, 3 4, 5 -6, 1 2))"));
+  ASSERT_EQ(CASS_OK, dse_polygon_envelope(polygon, &min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(1.0, min_x); ASSERT_EQ(-6.0, min_y);
+  ASSERT_EQ(5.0, max_x); ASSERT_EQ(4.0, max_y);
+
+  dse_polygon_reset(polygon);
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE,
+            dse_polygon_envelope(polygon, &min_x, &min_y, &max_x, &max_y));
+}
+
+TEST_F(PolygonUnitTest, SeekRing) {
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+    for (int j = 0; j < 3 + i; ++j) {
+      ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, i, j));
+    }
+  }
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  DsePolygonIterator* iterator = dse_polygon_iterator_new();
+  ASSERT_EQ(CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS, dse_polygon_iterator_seek_ring(iterator, 0));
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_reset(iterator, to_value()));
+
+  cass_uint32_t num_points;
+  for (cass_uint32_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(CASS_OK, dse_polygon_iterator_ring_num_points(iterator, i, &num_points));
+    ASSERT_EQ(3u + i, num_points);
+  }
+  ASSERT_EQ(CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS,
+            dse_polygon_iterator_ring_num_points(iterator, 3, &num_points));
+
+  // Skip to the last ring then go back to the first
+  cass_double_t x, y;
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_seek_ring(iterator, 2));
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_num_points(iterator, &num_points));
+  ASSERT_EQ(5u, num_points);
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_point(iterator, &x, &y));
+  ASSERT_EQ(2.0, x); ASSERT_EQ(0.0, y);
+
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_seek_ring(iterator, 0));
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_polygon_iterator_next_point(iterator, &x, &y));
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_num_points(iterator, &num_points));
+  ASSERT_EQ(3u, num_points);
+  for (int j = 0; j < 3; ++j) {
+    ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_point(iterator, &x, &y));
+    ASSERT_EQ(0.0, x); ASSERT_EQ(static_cast<cass_double_t>(j), y);
+  }
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_next_num_points(iterator, &num_points));
+  ASSERT_EQ(4u, num_points);
+  ASSERT_EQ(CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS, dse_polygon_iterator_seek_ring(iterator, 3));
+
+  // A failed reset doesn't leave any rings to seek to
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA,
+            iterator->from()->reset_binary(polygon->bytes().data(), polygon->bytes().size() - 1));
+  ASSERT_EQ(CASS_ERROR_LIB_INDEX_OUT_OF_BOUNDS, dse_polygon_iterator_seek_ring(iterator, 0));
+
+  dse_polygon_iterator_free(iterator);
+}
+
+TEST_F(PolygonUnitTest, ResetTrusted) {
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 0, 1));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 2, 3));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 4, 5));
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  DsePolygonIterator* iterator = dse_polygon_iterator_new();
+  ASSERT_EQ(CASS_OK, dse_polygon_iterator_reset_trusted(iterator, to_value()));
+  ASSERT_EQ(2u, dse_polygon_iterator_num_rings(iterator));
+  dse_polygon_iterator_free(iterator);
+
+  // The same as the validated reset for valid data
+  const dse::Bytes& bytes = polygon->bytes();
+  dse::PolygonIterator unchecked;
+  ASSERT_EQ(CASS_OK, unchecked.reset_binary_unchecked(bytes.data(), bytes.size()));
+  ASSERT_EQ(2u, unchecked.num_rings());
+
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_OK, unchecked.ring_num_points(1, &num_points));
+  ASSERT_EQ(0u, num_points);
+  ASSERT_EQ(CASS_OK, unchecked.next_num_points(&num_points));
+  ASSERT_EQ(3u, num_points);
+  cass_double_t x, y;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(CASS_OK, unchecked.next_point(&x, &y));
+    ASSERT_EQ(2.0 * i, x); ASSERT_EQ(2.0 * i + 1.0, y);
+  }
+  ASSERT_EQ(CASS_OK, unchecked.next_num_points(&num_points));
+  ASSERT_EQ(0u, num_points);
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, unchecked.next_num_points(&num_points));
+
+  // A truncated last ring is found when it's reached
+  ASSERT_EQ(CASS_OK, unchecked.reset_binary_unchecked(bytes.data(), bytes.size() - 1));
+  ASSERT_EQ(CASS_OK, unchecked.next_num_points(&num_points));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(CASS_OK, unchecked.next_point(&x, &y));
+  }
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.next_num_points(&num_points));
+
+  // The header is still checked
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA,
+            unchecked.reset_binary_unchecked(bytes.data(), WKB_POLYGON_HEADER_SIZE - 1));
+  ASSERT_EQ(0u, unchecked.num_rings());
+}
+
+TEST_F(PolygonUnitTest, ResetTrustedTruncated) {
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+    ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 0, 1));
+    ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 2, 3));
+    ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 4, 5));
+  }
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  // Cut inside of the points of the first ring. The data is copied so that
+  // reads past its end are detected.
+  const dse::Bytes& bytes = polygon->bytes();
+  dse::Bytes truncated(bytes.begin(),
+                       bytes.begin() + WKB_POLYGON_HEADER_SIZE + sizeof(cass_uint32_t) + 20);
+
+  dse::PolygonIterator unchecked;
+  ASSERT_EQ(CASS_OK, unchecked.reset_binary_unchecked(truncated.data(), truncated.size()));
+
+  cass_uint32_t num_points;
+  cass_double_t min_x, min_y, max_x, max_y;
+  cass_bool_t result;
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.next_num_points(&num_points));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.seek_ring(1));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.ring_num_points(0, &num_points));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.envelope(&min_x, &min_y, &max_x, &max_y));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.contains_point(1.0, 1.0, &result));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA,
+            unchecked.intersects_box(0.0, 0.0, 1.0, 1.0, &result));
+
+  // A corrupt number of points
+  dse::Bytes corrupt(bytes);
+  dse::encode(0xFFFFFFFFu, WKB_POLYGON_HEADER_SIZE, corrupt);
+  ASSERT_EQ(CASS_OK, unchecked.reset_binary_unchecked(corrupt.data(), corrupt.size()));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.next_num_points(&num_points));
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA, unchecked.seek_ring(1));
+
+  // More rings than could fit in the data
+  dse::encode(0xFFFFFFFFu, WKB_HEADER_SIZE, corrupt);
+  ASSERT_EQ(CASS_ERROR_LIB_NOT_ENOUGH_DATA,
+            unchecked.reset_binary_unchecked(corrupt.data(), corrupt.size()));
+  ASSERT_EQ(0u, unchecked.num_rings());
+}
+
+TEST_F(PolygonUnitTest, Simplify) {
+  ASSERT_EQ(CASS_OK, dse_polygon_from_wkt(polygon,
+                                          "POLYGON ((0 0, 5 0, 10 0, 10 5, 10 10, 5 10.01, 0 10, 0 0), "
+                                          "(4 4, 6 4, 5 4.01, 4 4))"));
+  ASSERT_EQ(CASS_OK, dse_polygon_simplify(polygon, 0.1));
+
+  // The hole would be left with 3 points so it's kept
+  ASSERT_EQ("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 5 4.01, 4 4))", polygon->to_wkt());
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(to_value()));
+  ASSERT_EQ(2u, iterator.num_rings());
+
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_OK, iterator.ring_num_points(0, &num_points));
+  ASSERT_EQ(5u, num_points);
+  ASSERT_EQ(CASS_OK, iterator.ring_num_points(1, &num_points));
+  ASSERT_EQ(4u, num_points);
+
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_polygon_simplify(polygon, 0.1));
+}
@@ -0,0 +1,270 @@
+/*
+  Copyright (c) 2016 DataStax, Inc.
+
+  This software can be used solely with DataStax Enterprise. Please consult the
+  license at http://www.datastax.com/terms/datastax-dse-driver-license-terms
+*/
+
+#include <gtest/gtest.h>
+
+#include "dse.h"
+#include "polygon.hpp"
+#include "spatial.hpp"
+#include "spatial_key.hpp"
+
+#include <limits>
+#include <math.h>
+#include <stdlib.h>
+
+class SpatialUnitTest : public testing::Test {
+public:
+  void SetUp() {
+    polygon = dse_polygon_new();
+  }
+
+  void TearDown() {
+    dse_polygon_free(polygon);
+  }
+
+  // A 10 x 10 square with a 2 x 2 hole in the middle
+  void square_with_hole() {
+    ASSERT_EQ(CASS_OK, dse_polygon_from_wkt(polygon,
+                                            "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), "
+                                            "(4 4, 6 4, 6 6, 4 6, 4 4))"));
+  }
+
+  bool contains(cass_double_t x, cass_double_t y) {
+    cass_bool_t result;
+    EXPECT_EQ(CASS_OK, dse_polygon_contains_point(polygon, x, y, &result));
+    return result == cass_true;
+  }
+
+  bool intersects(cass_double_t min_x, cass_double_t min_y,
+                  cass_double_t max_x, cass_double_t max_y) {
+    cass_bool_t result;
+    EXPECT_EQ(CASS_OK, dse_polygon_intersects_box(polygon, min_x, min_y, max_x, max_y, &result));
+    return result == cass_true;
+  }
+
+  DsePolygon* polygon;
+};
+
+TEST_F(SpatialUnitTest, ContainsPoint) {
+  square_with_hole();
+
+  ASSERT_TRUE(contains(1.0, 1.0));
+  ASSERT_TRUE(contains(9.5, 5.0));
+  ASSERT_TRUE(contains(5.0, 3.0));
+  ASSERT_FALSE(contains(5.0, 5.0)); // Hole
+  ASSERT_FALSE(contains(-1.0, 5.0));
+  ASSERT_FALSE(contains(11.0, 5.0));
+  ASSERT_FALSE(contains(5.0, 10.5));
+}
+
+TEST_F(SpatialUnitTest, ContainsPointUnclosed) {
+  // The ring is implicitly closed
+  ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 0.0, 0.0));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 4.0, 0.0));
+  ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 0.0, 4.0));
+
+  cass_bool_t result;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, dse_polygon_contains_point(polygon, 1.0, 1.0, &result));
+  ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+  ASSERT_TRUE(contains(1.0, 1.0));
+  ASSERT_FALSE(contains(3.0, 3.0));
+}
+
+TEST_F(SpatialUnitTest, ContainsPointManyEdges) {
+  // Compare against a circle using enough points to use the vectorized path
+  // for an odd and even number of edges
+  for (int num_points = 64; num_points <= 65; ++num_points) {
+    dse_polygon_reset(polygon);
+    ASSERT_EQ(CASS_OK, dse_polygon_start_ring(polygon));
+    for (int i = 0; i < num_points; ++i) {
+      double angle = 2.0 * 3.141592653589793 * i / num_points;
+      ASSERT_EQ(CASS_OK, dse_polygon_add_point(polygon, 10.0 * cos(angle), 10.0 * sin(angle)));
+    }
+    ASSERT_EQ(CASS_OK, dse_polygon_finish(polygon));
+
+    srand(num_points);
+    for (int i = 0; i < 1000; ++i) {
+      double x = 24.0 * rand() / RAND_MAX - 12.0;
+      double y = 24.0 * rand() / RAND_MAX - 12.0;
+      double distance = sqrt(x * x + y * y);
+      if (distance < 9.8) {
+        ASSERT_TRUE(contains(x, y));
+      } else if (distance > 10.0) {
+        ASSERT_FALSE(contains(x, y));
+      }
+    }
+  }
+}
+
+TEST_F(SpatialUnitTest, IntersectsBox) {
+  square_with_hole();
+
+  ASSERT_TRUE(intersects(1.0, 1.0, 2.0, 2.0)); // Inside
+  ASSERT_TRUE(intersects(-5.0, -5.0, 15.0, 15.0)); // Contains the polygon
+  ASSERT_TRUE(intersects(9.0, -1.0, 11.0, 1.0)); // Overlaps a corner
+  ASSERT_TRUE(intersects(3.0, 4.5, 7.0, 5.5)); // Crosses the hole
+  ASSERT_TRUE(intersects(10.0, 10.0, 12.0, 12.0)); // Touches a vertex
+  ASSERT_FALSE(intersects(4.5, 4.5, 5.5, 5.5)); // Inside the hole
+  ASSERT_FALSE(intersects(11.0, 11.0, 12.0, 12.0));
+  ASSERT_FALSE(intersects(-3.0, 2.0, -1.0, 8.0));
+
+  cass_bool_t result;
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_polygon_intersects_box(polygon, 2.0, 2.0, 1.0, 1.0, &result));
+}
+
+TEST_F(SpatialUnitTest, Iterator) {
+  square_with_hole();
+
+  dse::PolygonIterator iterator;
+  cass_bool_t result;
+  ASSERT_EQ(CASS_ERROR_LIB_INVALID_STATE, iterator.contains_point(1.0, 1.0, &result));
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(polygon->bytes().data(), polygon->bytes().size()));
+
+  ASSERT_EQ(CASS_OK, iterator.contains_point(1.0, 1.0, &result));
+  ASSERT_EQ(cass_true, result);
+  ASSERT_EQ(CASS_OK, iterator.contains_point(5.0, 5.0, &result));
+  ASSERT_EQ(cass_false, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(3.0, 4.5, 7.0, 5.5, &result));
+  ASSERT_EQ(cass_true, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(4.5, 4.5, 5.5, 5.5, &result));
+  ASSERT_EQ(cass_false, result);
+
+  // Iterators don't have an envelope to reject boxes with first
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(1.0, 1.0, 2.0, 2.0, &result));
+  ASSERT_EQ(cass_true, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(-5.0, -5.0, 15.0, 15.0, &result));
+  ASSERT_EQ(cass_true, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(11.0, 11.0, 12.0, 12.0, &result));
+  ASSERT_EQ(cass_false, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(-3.0, 2.0, -1.0, 8.0, &result));
+  ASSERT_EQ(cass_false, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(12.0, 2.0, 14.0, 8.0, &result));
+  ASSERT_EQ(cass_false, result);
+
+  // The iterator's position isn't changed
+  cass_uint32_t num_points;
+  ASSERT_EQ(CASS_OK, iterator.next_num_points(&num_points));
+  ASSERT_EQ(5u, num_points);
+}
+
+TEST_F(SpatialUnitTest, IteratorSwapped) {
+  // Big-endian when the native byte order is little-endian and vice versa
+  const cass_double_t points[] = { 0.0, 0.0, 4.0, 0.0, 4.0, 4.0, 0.0, 4.0, 0.0, 0.0 };
+  dse::Bytes bytes;
+  bytes.push_back(dse::native_byte_order() == dse::WKB_BYTE_ORDER_LITTLE_ENDIAN
+                  ? dse::WKB_BYTE_ORDER_BIG_ENDIAN : dse::WKB_BYTE_ORDER_LITTLE_ENDIAN);
+  dse::encode_append(dse::swap_uint32(dse::WKB_GEOMETRY_TYPE_POLYGON), bytes);
+  dse::encode_append(dse::swap_uint32(1), bytes);
+  dse::encode_append(dse::swap_uint32(5), bytes);
+  for (int i = 0; i < 10; ++i) {
+    cass_uint64_t temp;
+    memcpy(&temp, &points[i], sizeof(cass_uint64_t));
+    dse::encode_append(dse::swap_uint64(temp), bytes);
+  }
+
+  dse::PolygonIterator iterator;
+  ASSERT_EQ(CASS_OK, iterator.reset_binary(&bytes[0], bytes.size()));
+
+  cass_bool_t result;
+  ASSERT_EQ(CASS_OK, iterator.contains_point(1.0, 3.0, &result));
+  ASSERT_EQ(cass_true, result);
+  ASSERT_EQ(CASS_OK, iterator.contains_point(5.0, 3.0, &result));
+  ASSERT_EQ(cass_false, result);
+  ASSERT_EQ(CASS_OK, iterator.intersects_box(3.0, 3.0, 5.0, 5.0, &result));
+  ASSERT_EQ(cass_true, result);
+}
+
+TEST_F(SpatialUnitTest, HaversineDistance) {
+  // One degree along the equator or a meridian
+  const double degree = DSE_EARTH_RADIUS * 3.141592653589793 / 180.0;
+  ASSERT_NEAR(degree, dse_haversine_distance(0.0, 0.0, 1.0, 0.0), 1e-6);
+  ASSERT_NEAR(degree, dse_haversine_distance(0.0, 0.0, 0.0, -1.0), 1e-6);
+  ASSERT_EQ(0.0, dse_haversine_distance(12.5, 41.9, 12.5, 41.9));
+
+  // Antipodal points
+  ASSERT_NEAR(180.0 * degree, dse_haversine_distance(0.0, 0.0, 180.0, 0.0), 1e-6);
+
+  const cass_double_t xs[] = { 1.0, 0.0, 2.3522 };
+  const cass_double_t ys[] = { 0.0, -1.0, 48.8566 };
+  cass_double_t distances[3];
+  dse_haversine_distance_n(-0.1276, 51.5072, xs, ys, 3, distances);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(dse_haversine_distance(-0.1276, 51.5072, xs[i], ys[i]), distances[i]);
+  }
+  ASSERT_NEAR(343500.0, distances[2], 1000.0); // London to Paris
+}
+
+TEST_F(SpatialUnitTest, Geohash) {
+  const cass_double_t xs[] = { 10.40744, -5.6, 180.0, -180.0 };
+  const cass_double_t ys[] = { 57.64911, 42.6, 90.0, -90.0 };
+  char output[4 * 11];
+  ASSERT_EQ(CASS_OK, dse_geohash_n(xs, ys, 4, 11, output));
+  ASSERT_EQ("u4pruydqqvj", std::string(output, 11));
+  ASSERT_EQ("ezs42", std::string(output + 11, 5));
+  ASSERT_EQ("zzzzzzzzzzz", std::string(output + 22, 11));
+  ASSERT_EQ("00000000000", std::string(output + 33, 11));
+
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_geohash_n(xs, ys, 4, 13, output));
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS, dse_geohash_n(xs, ys, 4, 0, output));
+}
+
+TEST_F(SpatialUnitTest, MortonCode) {
+  // Enough points to use both the vectorized and scalar paths across chunks
+  std::vector<cass_double_t> xs, ys;
+  for (int i = 0; i < 1001; ++i) {
+    xs.push_back((i * 37) % 1000 / 1000.0);
+    ys.push_back((i * 91) % 1000 / 1000.0);
+  }
+  xs.push_back(-1.0); ys.push_back(2.0); // Clamped
+  xs.push_back(std::numeric_limits<cass_double_t>::quiet_NaN()); ys.push_back(0.0);
+
+  std::vector<cass_uint64_t> codes(xs.size());
+  ASSERT_EQ(CASS_OK, dse_morton_code_n(&xs[0], &ys[0], xs.size(), 0.0, 0.0, 1.0, 1.0, &codes[0]));
+  for (size_t i = 0; i < xs.size(); ++i) {
+    cass_uint64_t cell_x = 0, cell_y = 0;
+    for (int bit = 0; bit < 32; ++bit) {
+      cell_x |= ((codes[i] >> (2 * bit + 1)) & 1) << bit;
+      cell_y |= ((codes[i] >> (2 * bit)) & 1) << bit;
+    }
+    if (i < 1001) {
+      ASSERT_EQ(static_cast<cass_uint64_t>(xs[i] * 4294967296.0), cell_x);
+      ASSERT_EQ(static_cast<cass_uint64_t>(ys[i] * 4294967296.0), cell_y);
+    }
+  }
+  ASSERT_EQ(0x5555555555555555ULL, codes[1001]); // x = 0, y = 2^32 - 1
+  ASSERT_EQ(0u, codes[1002]);
+
+  ASSERT_EQ(CASS_ERROR_LIB_BAD_PARAMS,
+            dse_morton_code_n(&xs[0], &ys[0], xs.size(), 1.0, 0.0, 1.0, 1.0, &codes[0]));
+}
+
+TEST_F(SpatialUnitTest, HilbertIndex) {
+  // The centers of a 16 x 16 grid visited in Hilbert order are each next to
+  // the previous one
+  std::vector<cass_double_t> xs, ys;
+  for (int i = 0; i < 256; ++i) {
+    xs.push_back(i % 16 + 0.5);
+    ys.push_back(i / 16 + 0.5);
+  }
+  std::vector<cass_uint64_t> indices(256);
+  ASSERT_EQ(CASS_OK, dse_hilbert_index_n(&xs[0], &ys[0], 256, 0.0, 0.0, 16.0, 16.0, &indices[0]));
+
+  std::vector<int> cells(256, -1);
+  for (int i = 0; i < 256; ++i) {
+    cass_uint64_t index = indices[i] >> 56; // The first 4 levels
+    ASSERT_EQ(-1, cells[index]);
+    cells[index] = i;
+  }
+  ASSERT_EQ(0, cells[0]); // Starts at the origin
+  for (int i = 1; i < 256; ++i) {
+    int dx = abs(cells[i] % 16 - cells[i - 1] % 16);
+    int dy = abs(cells[i] / 16 - cells[i - 1] / 16);
+    ASSERT_EQ(1, dx + dy);
+  }
+}